@@ -10,4 +10,7 @@ void init_asset_paths(void);
 // Get the full path to an asset file
 const char* get_asset_path(const char* filename);
 
+// Get the directory that holds all asset files
+const char* get_asset_directory(void);
+
 #endif // ASSET_PATHS_H
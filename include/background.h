@@ -8,6 +8,9 @@ typedef struct
     int chunk_index;
     Vector3 *mountain_points;
     int mountain_point_count;
+    Vector2 *fill_strip;    // Triangle strip of (peak, ground) pairs in world space, built once per chunk
+    int fill_strip_count;
+    Vector2 *outline_strip; // Mountain outline as a world-space line strip
     bool generated;
 } BackgroundChunk;
 
@@ -21,20 +24,31 @@ typedef struct
 
 typedef struct
 {
-    BackgroundChunk *chunks;
+    int chunk_hits;   // Chunk lookups served from the cache
+    int chunk_misses; // Chunk lookups that had to generate (including look-ahead)
+    int cloud_hits;
+    int cloud_misses;
+} BackgroundCacheStats;
+
+typedef struct
+{
+    BackgroundChunk *chunks; // Direct-mapped by chunk_index modulo max_chunks
     Cloud *clouds;
     int max_chunks;
     int max_clouds;
+    int chunk_radius; // Chunks drawn either side of the camera's chunk
+    int cloud_radius; // Clouds drawn either side of the camera's cloud
     int chunk_size; // Width of each chunk in pixels
     float mountain_base_height;
     int seed_variant; // Variant seed for different procedural backgrounds per level
     Camera2D camera;
+    BackgroundCacheStats stats;
 } Background;
 
 // Background functions
 Background background_create(void);
 Background background_create_with_variant(int seed_variant);
-void background_update(Background *bg, Vector2 player_pos);
+void background_update(Background *bg, Vector2 player_pos, Vector2 player_velocity);
 void background_draw(Background *bg);
 void background_draw_with_hazards(Background *bg, const void *hazard_list);
 void background_cleanup(Background *bg);
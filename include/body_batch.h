@@ -0,0 +1,62 @@
+#ifndef BODY_BATCH_H
+#define BODY_BATCH_H
+
+#include "raylib.h"
+
+// Batch integrator for the simple dynamic bodies (loot, pickups, projectiles).
+//
+// A list copies its active bodies into the batch's arrays (one per field), integrates them
+// all in one pass, then copies the results back and deactivates whatever expired. The pass
+// runs 8 bodies at a time with AVX2 (when built with KNIGHT_AVX2), 4 at a time with SSE2,
+// and one at a time otherwise; every path gives exactly the same results.
+//
+// Per body and step, in this order:
+//   fall:   unless grounded, velocity.y += gravity * dt; at or below ground_y it lands
+//           (y = ground_y, velocity.y = 0, grounded)
+//   move:   position += velocity * dt
+//   spin:   rotation += spin * dt
+//   age:    lifetime -= dt
+//   expire: lifetime used up, more than 1000px outside the view horizontally (VIEW_WIDTH
+//           wide, centered on camera_x), or below despawn_y
+
+// Movement rules shared by every body of one kind
+typedef struct
+{
+    float gravity;   // Added to velocity.y per second
+    float spin;      // Rotation per second
+    float ground_y;  // Bodies land here (INFINITY = no ground)
+    float despawn_y; // Bodies lower than this expire (INFINITY = never)
+} BodyKind;
+
+typedef struct
+{
+    float *x;
+    float *y;
+    float *velocity_x;
+    float *velocity_y;
+    float *rotation;
+    float *lifetime;
+    int *grounded; // 0 or 1
+    int *source;   // Index of the body in the list it was copied from
+
+    int *expired;      // Source indices that expired in the last integrate, in batch order
+    int expired_count;
+
+    int count;
+    int capacity;
+} BodyBatch;
+
+BodyBatch body_batch_create(int capacity);
+void body_batch_cleanup(BodyBatch *batch);
+
+// Empty the batch and make room for up to count bodies
+void body_batch_begin(BodyBatch *batch, int count);
+
+// Append a body. Call body_batch_begin with enough room first.
+int body_batch_add(BodyBatch *batch, int source, Vector2 position, Vector2 velocity,
+                   float rotation, float lifetime, bool grounded);
+
+// Advance every body in the batch by one step and fill expired. camera_x is the center of the view.
+void body_batch_integrate(BodyBatch *batch, const BodyKind *kind, float camera_x, float delta_time);
+
+#endif // BODY_BATCH_H
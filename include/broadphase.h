@@ -0,0 +1,111 @@
+#ifndef BROADPHASE_H
+#define BROADPHASE_H
+
+#include "raylib.h"
+
+// Sweep-and-prune broadphase along X.
+//
+// Every collidable thing is a proxy: an axis-aligned box plus a layer (what it is) and a
+// mask (which layers it wants to hear about). Proxies are kept in an array sorted by their
+// left edge. Entities move only a little between ticks, so re-sorting with insertion sort
+// is close to linear, and one sweep over the sorted array finds every overlapping pair.
+//
+// Proxies are addressed by (kind, index): the entity list they mirror and the position in
+// that list. Call broadphase_set for every live entity each tick, broadphase_disable for
+// inactive ones, then broadphase_find_pairs.
+
+typedef enum
+{
+    COLLISION_LAYER_PLAYER = 1 << 0,
+    COLLISION_LAYER_SWORD = 1 << 1,
+    COLLISION_LAYER_HAZARD = 1 << 2,
+    COLLISION_LAYER_MONSTER = 1 << 3,
+    COLLISION_LAYER_PLAYER_SHOT = 1 << 4,
+    COLLISION_LAYER_MONSTER_SHOT = 1 << 5,
+    COLLISION_LAYER_PICKUP = 1 << 6,
+    COLLISION_LAYER_LOOT = 1 << 7
+} CollisionLayer;
+
+typedef enum
+{
+    BROADPHASE_PLAYER, // Index 0 = body, 1 = sword
+    BROADPHASE_HAZARD,
+    BROADPHASE_MONSTER,
+    BROADPHASE_PROJECTILE,
+    BROADPHASE_PICKUP,
+    BROADPHASE_LOOT,
+    BROADPHASE_KIND_COUNT
+} BroadphaseKind;
+
+typedef struct
+{
+    float min_x, max_x;
+    float min_y, max_y;
+    unsigned int layer; // CollisionLayer bit of this proxy
+    unsigned int mask;  // Layers this proxy collides with
+    BroadphaseKind kind;
+    int index; // Index in the entity list the proxy mirrors
+    bool enabled;
+} BroadphaseProxy;
+
+typedef struct
+{
+    int a; // Proxy ids, a sorted before b along X
+    int b;
+} BroadphasePair;
+
+typedef struct
+{
+    int first;  // Entity index of the first kind
+    int second; // Entity index of the second kind
+} BroadphaseHit;
+
+typedef struct
+{
+    int *proxy_ids; // Entity index -> proxy id (-1 = none yet)
+    int count;
+    int capacity;
+} BroadphaseKindTable;
+
+typedef struct
+{
+    BroadphaseProxy *proxies;
+    int proxy_count;
+    int proxy_capacity;
+    int *order; // Proxy ids sorted by min_x
+    BroadphaseKindTable kinds[BROADPHASE_KIND_COUNT];
+    BroadphasePair *pairs; // Output of the last broadphase_find_pairs
+    int pair_count;
+    int pair_capacity;
+    BroadphaseHit *hits; // Output of the last broadphase_collect
+    int hit_capacity;
+} Broadphase;
+
+Broadphase broadphase_create(int capacity);
+void broadphase_cleanup(Broadphase *broadphase);
+
+// Forget every proxy, e.g. when a different level starts
+void broadphase_clear(Broadphase *broadphase);
+
+// Register or move the proxy for an entity
+void broadphase_set(Broadphase *broadphase, BroadphaseKind kind, int index, Rectangle bounds,
+                    unsigned int layer, unsigned int mask);
+
+// Keep an entity's proxy out of pairs until it is set again
+void broadphase_disable(Broadphase *broadphase, BroadphaseKind kind, int index);
+
+// Disable the proxies of a kind from index count on (the list got shorter)
+void broadphase_truncate(Broadphase *broadphase, BroadphaseKind kind, int count);
+
+// Re-sort and sweep. Fills broadphase->pairs with every enabled pair whose boxes touch and
+// where either mask accepts the other layer. Returns the number of pairs.
+int broadphase_find_pairs(Broadphase *broadphase);
+
+// Pick the pairs between two kinds (restricted to the given layers) out of the last
+// broadphase_find_pairs into broadphase->hits, sorted by first then second entity index so
+// they can be handled in the same order as a nested loop over both lists. With unique_first
+// each first entity appears once. Returns the number of hits.
+int broadphase_collect(Broadphase *broadphase, BroadphaseKind first_kind, unsigned int first_layers,
+                       BroadphaseKind second_kind, unsigned int second_layers, bool unique_first);
+
+#endif // BROADPHASE_H
@@ -0,0 +1,19 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include "raylib.h"
+
+// Swept box tests. A box that moves further than its own size in one tick can jump clean
+// over a target if only its end position is checked; these test the whole path instead.
+
+// Find when two boxes moving in straight lines over one step first overlap. a and b go
+// from their *_from to their *_to rectangle (same size at both ends; pass the same
+// rectangle twice for something that does not move). time_of_impact gets the fraction of
+// the step (0 = start, 1 = end). Overlap at the end of the step always counts, so this
+// never misses a hit CheckCollisionRecs(a_to, b_to) would report.
+bool collision_sweep(Rectangle a_from, Rectangle a_to, Rectangle b_from, Rectangle b_to, float *time_of_impact);
+
+// Smallest rectangle containing a box at both ends of its move (for the broadphase)
+Rectangle collision_sweep_bounds(Rectangle from, Rectangle to);
+
+#endif // COLLISION_H
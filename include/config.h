@@ -7,6 +7,12 @@
 #define JUMP_POWER 400.0f
 #define PLAYER_SPEED 200.0f
 
+// Simulation settings
+#define SIMULATION_TICK_RATE 120                    // Fixed simulation ticks per second
+#define SIMULATION_DT (1.0f / SIMULATION_TICK_RATE) // Length of one simulation tick (in seconds)
+#define MAX_FRAME_TIME 0.25f                        // Longest frame the simulation catches up on (in seconds)
+#define VIEW_WIDTH 1280                             // Window width; the simulation uses this instead of asking the window
+
 // Player health settings
 #define MAX_HEARTS 3
 #define INITIAL_HEARTS 3
@@ -14,6 +20,26 @@
 // Monster settings
 #define MONSTER_DEAD_TEXTURE_TIME 5.0f // Time to show dead texture before removing monster
 
+// Monster AI think rates, by horizontal distance from the camera (see think_schedule.h)
+#define AI_NEAR_DISTANCE 1000.0f // Closer than this: every tick (the view is VIEW_WIDTH / 2 either side)
+#define AI_MID_DISTANCE 3000.0f  // Closer than this: AI_MID_THINK_RATE; further away: dormant
+#define AI_MID_THINK_RATE 10     // Thinks per second in the mid band
+
+// Sector sleep regions (see sector.h). The awake span reaches at least
+// SIM_SECTOR_RADIUS * SIM_SECTOR_WIDTH past the camera on both sides; keep that beyond
+// AI_MID_DISTANCE so no monster thinks in a sleeping sector.
+#define SIM_SECTOR_WIDTH 1024.0f // Width of one sector
+#define SIM_SECTOR_RADIUS 3      // Sectors either side of the camera's sector that stay awake
+
+// Collision narrow phase (see contacts.h)
+#if !defined(_WIN32)
+#define CONTACT_THREADS 4           // Threads the game tests candidates on, counting the game thread
+#else
+#define CONTACT_THREADS 1           // No pthreads: everything on the game thread
+#endif
+#define CONTACT_JOB_CANDIDATES 64   // Candidates per job
+#define CONTACT_PARALLEL_MIN 512    // Fewer candidates than this are tested on the game thread alone
+
 // Game state settings
 #define PAUSE_DURATION 2.0f                 // Duration of pause after losing a heart (in seconds)
 #define DAMAGE_DISPLAY_MONSTER_HIT 0.5f     // Duration to display monster hit texture (in seconds)
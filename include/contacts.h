@@ -0,0 +1,85 @@
+#ifndef CONTACTS_H
+#define CONTACTS_H
+
+#include <stdbool.h>
+#include "broadphase.h"
+
+// Two-phase collision pipeline: parallel detection, serial resolution.
+//
+// The broadphase candidates of each category are copied in, split into jobs of
+// CONTACT_JOB_CANDIDATES, and tested by a narrow-phase function that only reads the world
+// (and writes nothing another candidate reads). With CONTACT_PARALLEL_MIN candidates or
+// more, the jobs are spread over CONTACT_THREADS threads, each writing to its own buffer;
+// fewer run on the calling thread. The buffers are then merged and stably sorted by
+// (category, first, second). A candidate gives at most one contact and broadphase hits are
+// distinct pairs, so the contacts come out in the same order however the jobs were spread,
+// and the caller resolves them one by one on its own thread.
+//
+// Builds without pthreads (Windows) always test on the calling thread.
+
+// In resolution order
+typedef enum
+{
+    CONTACT_PLAYER_HAZARD,      // first = hazard
+    CONTACT_SWORD_MONSTER,      // first = monster
+    CONTACT_PLAYER_MONSTER,     // first = monster
+    CONTACT_PLAYER_PICKUP,      // first = pickup
+    CONTACT_PLAYER_LOOT,        // first = loot item
+    CONTACT_PROJECTILE_MONSTER, // first = projectile, second = monster
+    CONTACT_PROJECTILE_PLAYER,  // first = projectile
+    CONTACT_CATEGORY_COUNT
+} ContactCategory;
+
+typedef struct
+{
+    ContactCategory category;
+    int first;            // Entity indices of the candidate, as the broadphase hit had them
+    int second;
+    float time_of_impact; // Fraction of the step, for swept tests (0 otherwise)
+} Contact;
+
+typedef struct
+{
+    Contact *contacts;
+    int count;
+    int capacity;
+} ContactBuffer;
+
+// Narrow phase for one candidate: true (and *time_of_impact set, if it applies) when the
+// pair really touches
+typedef bool (*ContactTest)(void *context, ContactCategory category, BroadphaseHit candidate, float *time_of_impact);
+
+typedef struct ContactWorkers ContactWorkers; // Worker threads (contacts.c)
+
+typedef struct
+{
+    BroadphaseHit *candidates[CONTACT_CATEGORY_COUNT];
+    int candidate_count[CONTACT_CATEGORY_COUNT];
+    int candidate_capacity[CONTACT_CATEGORY_COUNT];
+
+    ContactBuffer *buffers; // One per thread; buffers[0] is the calling thread's
+    int thread_count;
+    ContactWorkers *workers; // NULL when everything runs on the calling thread
+
+    Contact *contacts; // Output of the last contact_pipeline_run, sorted
+    int count;
+    int capacity;
+    Contact *scratch; // Merge sort space
+} ContactPipeline;
+
+// Start thread_count - 1 worker threads (none for 1)
+ContactPipeline contact_pipeline_create(int thread_count);
+void contact_pipeline_cleanup(ContactPipeline *pipeline);
+
+// Forget the candidates of the last run
+void contact_pipeline_begin(ContactPipeline *pipeline);
+
+// Copy in candidates for a category (e.g. straight from broadphase->hits)
+void contact_pipeline_add_candidates(ContactPipeline *pipeline, ContactCategory category,
+                                     const BroadphaseHit *hits, int count);
+
+// Test every candidate, then merge and sort the contacts into pipeline->contacts.
+// Returns the number of contacts.
+int contact_pipeline_run(ContactPipeline *pipeline, ContactTest test, void *context);
+
+#endif // CONTACTS_H
@@ -3,27 +3,29 @@
 
 #include "monster.h"
 #include "projectile.h"
+#include "timer_wheel.h"
 
 typedef struct
 {
-    float fire_cooldown;     // Time before dragon can fire again
-    float fire_cooldown_max; // Max cooldown between fires
-    float firing_range;      // Maximum range to fire projectiles
+    TimerHandle fire_cooldown; // Pending until the dragon can fire again (world timers)
+    float fire_cooldown_max;   // Max cooldown between fires
+    float firing_range;        // Maximum range to fire projectiles
 } DragonData;
 
-// Dragon-specific customizations
-void dragon_apply_customizations(Monster *dragon);
+// Dragon-specific data for a new dragon (the MONSTER_DRAGON archetype's custom_init)
+void dragon_init(Monster *dragon);
 
 // Custom dragon heart drawing function
 void dragon_draw_hearts(Monster *dragon, float screen_pos_x, float screen_pos_y);
 
-// Custom dragon update for firing projectiles
-void dragon_custom_update(Monster *dragon);
 
 // Custom dragon cleanup
 void dragon_cleanup(Monster *dragon);
 
-// Dragon firing function - call this to make dragon fire at a target
-void dragon_fire_at_target(Monster *dragon, ProjectileList *projectiles, Vector2 target_pos);
+// Dragon batch: every dragon that thinks this tick fires at the target when its cooldown
+// (on timers) is over and the target is in range. Dragons patrol with the rest in
+// monster_list_update.
+void dragon_batch_update(MonsterList *list, const MonsterBatch *batch, ProjectileList *projectiles,
+                         Vector2 target_pos, TimerWheel *timers);
 
 #endif // DRAGON_H
@@ -5,6 +5,14 @@
 #include "level.h"
 #include "projectile.h"
 #include "loot.h"
+#include "texture_cache.h"
+#include "player.h"
+#include "player_input.h"
+#include "broadphase.h"
+#include "timer_wheel.h"
+#include "sector.h"
+#include "game_events.h"
+#include "contacts.h"
 
 #define MAX_LEVELS 20
 
@@ -16,30 +24,45 @@ typedef enum
     GAME_SCREEN_OPTIONS
 } GameScreen;
 
+// Sections of game_step, timed individually when a StepTimings sink is attached
 typedef enum
 {
-    COLLISION_TYPE_NONE,
-    COLLISION_TYPE_HAZARD,
-    COLLISION_TYPE_MONSTER
-} CollisionType;
+    STEP_PHASE_HAZARDS,
+    STEP_PHASE_PLAYER,
+    STEP_PHASE_MONSTERS,    // Monster updates and dragon fire
+    STEP_PHASE_PROJECTILES, // Player firing and projectile movement
+    STEP_PHASE_PICKUPS,     // Pickup movement and spawners
+    STEP_PHASE_LOOT,
+    STEP_PHASE_COLLISIONS,  // All entity-vs-player and projectile-vs-monster checks
+    STEP_PHASE_RULES,       // Cooldowns, respawn, game over and goal checks
+    STEP_PHASE_COUNT
+} StepPhase;
+
+typedef struct
+{
+    unsigned long long ns[STEP_PHASE_COUNT]; // Nanoseconds accumulated per phase
+} StepTimings;
 
 typedef struct
 {
     int screen_width;
     int screen_height;
-    float delta_time;
+    float delta_time; // Length of the current simulation tick
     int fps;
     bool running;
     Level levels[MAX_LEVELS];
     int level_count;
     int current_level_index;
-    float burnt_message_timer;         // Timer for displaying damage message
+    TimerHandle burnt_message_timer;   // Damage message shown and game paused until this fires (timers)
     bool is_paused;                    // True when game is paused due to collision
-    float hazard_cooldown;             // Cooldown to prevent immediate re-collision after respawn
-    float sword_attack_cooldown;       // Cooldown to prevent immediate re-attack
+    TimerHandle hazard_cooldown;       // Cooldown to prevent immediate re-collision after respawn (timers)
+    TimerHandle sword_attack_cooldown; // Cooldown to prevent immediate re-attack (timers)
+    TimerWheel timers;                 // Game timers: stop only while the pause menu is open
+    TimerWheel world_timers;           // World timers: also stop while the game is paused after a hit
     bool game_over;                    // True when player loses all hearts
     CollisionType last_collision_type; // Track type of last collision
     ProjectileList projectiles;        // Active projectiles in the level
+    BodyBatch bodies;                  // Scratch space for the projectile, pickup and loot updates
     bool in_level_transition;          // True when showing level transition screen
     int next_level_index;              // The level to transition to
     bool game_victory;                 // True when game is complete
@@ -48,21 +71,38 @@ typedef struct
     GameScreen current_screen;         // Current screen being displayed (TITLE, PLAYING, VICTORY)
     int selected_menu_item;            // 0 = Select Level, 1 = Start Game, 2 = Exit (title) | 0 = Resume, 1 = Quit (pause)
     int selected_level;                // 0-13 corresponds to level 1-14
-    Texture2D menu_cursor_texture;     // Character texture used as menu cursor
+    TextureHandle menu_cursor_texture; // Character texture used as menu cursor
     bool pause_menu_active;            // True when pause menu is displayed during gameplay
     int pause_menu_selection;          // 0 = Resume Game, 1 = Quit To Menu
     Music background_music;            // Background music that loops throughout the game
     float music_volume;                // Music volume (0.0 to 1.0)
     bool options_menu_active;          // True when options menu is displayed
     int options_menu_selection;        // 0 = Volume Slider, 1 = Back
+    bool profiler_overlay_active;      // F3 frame profiler overlay (profiler builds only)
     GameScreen previous_screen;        // Previous screen before opening options
     LootSystem loot_system;            // Global loot system (shared across all levels)
+    Player player;                     // The knight
+    StepTimings *step_timings;         // Optional per-phase timing sink for benchmarks (NULL = off)
+    Broadphase broadphase;             // Collision proxies of the current level
+    SectorStats sector_stats;          // What the sector window skipped in the last tick
+    GameEventQueue events;             // What the collision checks found this tick, drained at their end
+    ContactPipeline contacts;          // Collision narrow phase: candidates, worker threads and contacts
 } GameState;
 
-// Game functions
+// Game functions (window, menus and rendering - game.c)
 void game_init(GameState *state);
-void game_update(GameState *state);
-void game_draw(GameState *state);
+void game_update(GameState *state, PlayerInput *input); // Per-frame menus and screen changes; samples input into *input
+void game_draw(GameState *state, float alpha);          // alpha = fraction of a tick to interpolate
 void game_cleanup(GameState *state);
+void game_start_level(GameState *state, int level_index); // game_sim_start_level plus the level's background
+void game_advance_level(GameState *state);                // game_sim_advance_level plus the level's background
+
+// Simulation functions (no window, GPU or input polling - game_sim.c)
+void game_sim_init(GameState *state, int contact_threads);                    // Create levels, loot tables and the player; contact_threads test collision candidates (1 = game thread only)
+void game_sim_start_level(GameState *state, int level_index);                 // Reset player and enemies and start playing a level
+void game_sim_advance_level(GameState *state);                                // Accept the level transition and start the next level
+bool game_sim_is_active(const GameState *state);                              // False on the title, options and level transition screens
+void game_step(GameState *state, const PlayerInput *input, float delta_time); // Advance the simulation by one fixed tick
+void game_sim_cleanup(GameState *state);                                      // Free levels, player and loot tables
 
 #endif // GAME_H
@@ -0,0 +1,65 @@
+#ifndef GAME_EVENTS_H
+#define GAME_EVENTS_H
+
+#include <stdbool.h>
+#include "damage.h"
+
+// Gameplay events: what the collision checks found, applied later in one place.
+//
+// The checks in game_step only detect. Each thing that happens is pushed onto the queue in
+// the order it was found, and the queue is drained once at the end of the collision phase,
+// where one handler per event type applies the consequences (damage, loot drops, inventory,
+// goal counters). Draining in queue order keeps a fixed-timestep run deterministic.
+
+typedef enum
+{
+    COLLISION_TYPE_NONE,
+    COLLISION_TYPE_HAZARD,
+    COLLISION_TYPE_MONSTER
+} CollisionType;
+
+typedef enum
+{
+    GAME_EVENT_MONSTER_KILLED,     // index = monster; drops its loot and counts towards the goal
+    GAME_EVENT_PLAYER_HIT,         // hit says how
+    GAME_EVENT_LOOT_COLLECTED,     // index = loot item the player touched
+    GAME_EVENT_PICKUP_COLLECTED,   // index = pickup the player touched
+    GAME_EVENT_PROJECTILE_EXPIRED, // index = projectile destroyed on impact
+} GameEventType;
+
+typedef struct
+{
+    int damage;
+    DamageType damage_type;
+    float display_duration;       // How long the damage texture shows
+    CollisionType collision_type; // Recorded as the last collision
+    bool contact;                 // Touching a hazard or monster: ignored while the hazard cooldown runs
+} PlayerHit;
+
+typedef struct
+{
+    GameEventType type;
+    int index;     // Entity the event is about (unused by GAME_EVENT_PLAYER_HIT)
+    PlayerHit hit; // GAME_EVENT_PLAYER_HIT only
+} GameEvent;
+
+typedef struct
+{
+    GameEvent *events; // In the order they were pushed
+    int count;
+    int capacity;
+} GameEventQueue;
+
+GameEventQueue game_event_queue_create(int capacity);
+void game_event_queue_cleanup(GameEventQueue *queue);
+
+// Forget every event (after draining)
+void game_event_queue_clear(GameEventQueue *queue);
+
+// Append an event about the entity at index
+void game_event_push(GameEventQueue *queue, GameEventType type, int index);
+
+// Append a GAME_EVENT_PLAYER_HIT
+void game_event_push_player_hit(GameEventQueue *queue, PlayerHit hit);
+
+#endif // GAME_EVENTS_H
@@ -2,6 +2,8 @@
 #define HAZARD_H
 
 #include "raylib.h"
+#include "texture_cache.h"
+#include "slot_map.h"
 
 typedef enum
 {
@@ -17,39 +19,61 @@ typedef struct
     HazardType type;
     Rectangle bounds;         // Position and size of the hazard
     Rectangle initial_bounds; // Original position and size (for reset)
+    Rectangle previous_bounds; // Bounds one tick before the last evaluation (for swept collision)
     int damage;               // Damage dealt on contact
     bool active;              // Whether the hazard is still active
-    Texture2D texture;        // Texture for visual representation
+    TextureHandle texture;    // Texture for visual representation
     bool can_move;            // Whether this hazard can move/patrol
-    Vector2 velocity;         // Current movement velocity
+    Vector2 velocity;         // Movement velocity: at the start when defined, then at the last evaluation
+    Vector2 initial_velocity; // Velocity at the start (recorded when added)
     float patrol_left_bound;  // Left boundary for movement
     float patrol_right_bound; // Right boundary for movement
     float patrol_speed;       // Speed of movement
     // Fade properties
     bool can_fade;              // Whether this hazard fades in/out
-    float fade_timer;           // Current time in fade cycle
     float fade_opaque_duration; // Time hazard remains fully opaque before fading
     float fade_out_duration;    // Time to fade out (0 = instant)
     float fade_out_interval;    // Time hazard stays faded out before fading back in
     float fade_in_duration;     // Time to fade in (0 = instant)
-    float current_opacity;      // Current opacity (0.0 = invisible, 1.0 = fully visible)
-    bool is_faded_out;          // Whether hazard is currently faded out (safe to pass)
+    float current_opacity;      // Opacity at the last evaluation (0.0 = invisible, 1.0 = fully visible)
+    bool is_faded_out;          // Whether hazard was faded out at the last evaluation (safe to pass)
+    double evaluated_time;      // Level time of the last evaluation
 } Hazard;
 
 typedef struct
 {
-    Hazard *hazards;
-    int count;
-    int capacity;
+    SLOT_MAP_FIELDS(Hazard, hazards)
 } HazardList;
 
+// Hazard list: hazard_list_create, hazard_list_add, hazard_list_cleanup, ... (see slot_map.h).
+// Adding a hazard records its starting bounds and loads its texture.
+SLOT_MAP_DECLARE(HazardList, Hazard, hazard_list)
+
 // Hazard functions
-HazardList hazard_list_create(int capacity);
-void hazard_list_cleanup(HazardList *list);
-void hazard_list_add(HazardList *list, Hazard hazard);
-bool hazard_check_collision(Hazard *hazard, Rectangle player_rect);
-void hazard_draw(Hazard *hazard, float camera_x);
-void hazard_update(Hazard *hazard);
+bool hazard_check_collision(const Hazard *hazard, Rectangle player_rect);
+
+// Like hazard_check_collision, but moving hazards (dust storms, wind daggers) are tested
+// along their whole path this step against the player's path, so they cannot pass through
+// each other on a long step
+bool hazard_check_swept_collision(const Hazard *hazard, Rectangle player_from, Rectangle player_to);
+
+// Area the hazard covered during the last step
+Rectangle hazard_swept_bounds(const Hazard *hazard);
+
+// Hazards move and fade as pure functions of the level time (see periodic.h), so they are
+// only evaluated when they are drawn or may collide. Between evaluations the stored bounds
+// and fade state go stale; hazard_reach tells whether an evaluation is needed.
+void hazard_draw(const Hazard *hazard, float camera_x, double time);
+
+// Bring bounds, previous_bounds, velocity and the fade state up to time
+void hazard_update(Hazard *hazard, double time);
+
+// Everywhere the hazard can have been during the tick ending at time, worked out from the
+// last evaluation and its top speed without evaluating. Collision candidates are found with
+// this box and then evaluated.
+Rectangle hazard_reach(const Hazard *hazard, double time);
+
+// Back to the start of the level (time 0)
 void hazard_reset(Hazard *hazard);
 
 // Initialize movement properties for a hazard based on type
@@ -64,6 +88,6 @@ void hazard_init_fade(Hazard *hazard, float fade_opaque_duration, float fade_out
 
 // Check if hazard is dangerous (not faded out)
 // Returns true if hazard can damage, false if faded out
-bool hazard_is_dangerous(Hazard *hazard);
+bool hazard_is_dangerous(const Hazard *hazard);
 
 #endif // HAZARD_H
@@ -0,0 +1,22 @@
+#ifndef INPUT_SCRIPT_H
+#define INPUT_SCRIPT_H
+
+#include "game.h"
+
+// Canned input patterns for headless runs and benchmarks
+typedef enum
+{
+    SCRIPT_IDLE, // Stand still
+    SCRIPT_WALK, // Walk right
+    SCRIPT_HOP,  // Walk right, jump every second, swing the sword and fire when possible
+    SCRIPT_COUNT
+} InputScript;
+
+// Input the script produces on a given tick (fire only when the player has ammo)
+PlayerInput input_script_next(InputScript script, long tick, const GameState *state);
+
+// Name <-> enum for command lines and reports. parse returns false for unknown names.
+bool input_script_parse(const char *name, InputScript *script);
+const char *input_script_name(InputScript script);
+
+#endif // INPUT_SCRIPT_H
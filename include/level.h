@@ -52,10 +52,12 @@ typedef struct
     HazardList hazards;
     MonsterList monsters;
     PickupList pickups;
+    PickupPool pickup_pool; // Spare pickups for the spawners
     bool completed;
     // Pickup spawning configuration
     PickupSpawnerList spawners; // List of pickup spawners for this level
     LootList loot;              // Active loot items in this level
+    unsigned int clock;         // Level clock: world ticks since the last reset
 } Level;
 
 // Level functions
@@ -63,7 +65,8 @@ Level level_create(int level_number, const char *name, BackgroundConfig backgrou
                    Vector2 start_pos, LevelGoal goal);
 void level_cleanup(Level *level);
 bool level_check_goal_reached(Level *level, Vector2 player_pos);
-void level_reset(Level *level);
+void level_reset(Level *level, TimerWheel *world_timers); // Restarts the spawner timers on world_timers
+double level_time(const Level *level);                     // Seconds on the level clock; hazards and patrols are functions of it
 void level_reactivate_enemies(Level *level);
 
 #endif // LEVEL_H
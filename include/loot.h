@@ -2,6 +2,10 @@
 #define LOOT_H
 
 #include "raylib.h"
+#include "texture_cache.h"
+#include "body_batch.h"
+#include "slot_map.h"
+#include "sector.h"
 
 // Loot type enumeration - extensible for different item types
 typedef enum
@@ -40,10 +44,11 @@ typedef struct
 typedef struct
 {
     Vector2 position;   // Current position
+    Vector2 previous_position; // Position before the last update (for render interpolation)
     Vector2 velocity;   // Current velocity (for falling animation)
     LootType type;      // Type of loot item
     int value;          // Quantity/value of this item
-    Texture2D texture;  // Visual representation
+    TextureHandle texture; // Visual representation (borrowed, owned by the inventory)
     float scale;        // Display scale
     bool active;        // Whether this loot is still available
     float lifetime;     // Seconds remaining before despawn
@@ -55,16 +60,14 @@ typedef struct
 // List container for active loot in the world
 typedef struct
 {
-    Loot *loot;   // Array of active loot items
-    int count;    // Current number of active items
-    int capacity; // Allocated capacity
+    SLOT_MAP_FIELDS(Loot, loot) // Active loot items: loot[0..count)
 } LootList;
 
 // Player inventory system
 typedef struct
 {
     int counts[LOOT_TYPE_COUNT];              // Count of each loot type
-    Texture2D loot_textures[LOOT_TYPE_COUNT]; // Textures for UI display
+    TextureHandle loot_textures[LOOT_TYPE_COUNT]; // Textures for UI display (owned references)
 } Inventory;
 
 // Loot system managing all loot tables across all monsters
@@ -94,16 +97,15 @@ void loot_table_cleanup(LootTable *table);
 
 // Active Loot Functions
 Loot loot_create(LootType type, Vector2 spawn_pos, int value, const Inventory *inventory);
-void loot_update(Loot *loot);
 void loot_draw(Loot *loot, float camera_x);
-void loot_apply_gravity(Loot *loot);
-
-// Loot List Functions
-LootList loot_list_create(int capacity);
-void loot_list_add(LootList *list, Loot loot);
-void loot_list_cleanup(LootList *list);
-void loot_list_update(LootList *list);
-void loot_list_draw(LootList *list, float camera_x);
+
+// Loot List Functions (loot_list_create, loot_list_add, ...: see slot_map.h)
+SLOT_MAP_DECLARE(LootList, Loot, loot_list)
+// Move active items in awake sectors one step and drop expired and collected ones; items in
+// sleeping sectors stay frozen. Items far outside the view around camera_x despawn.
+// Returns how many were frozen.
+int loot_list_update(LootList *list, BodyBatch *bodies, const SectorWindow *awake, float camera_x, float delta_time);
+void loot_list_draw(LootList *list, float camera_x, float alpha); // alpha = fraction of a tick to interpolate
 
 // Inventory Functions
 Inventory inventory_create(void);
@@ -2,14 +2,61 @@
 #define MONSTER_H
 
 #include "raylib.h"
+#include "texture_cache.h"
+#include "slot_map.h"
+#include "loot.h"
+#include "projectile.h"
+#include "timer_wheel.h"
+#include "periodic.h"
 
 // Forward declaration of Monster
 typedef struct Monster Monster;
 
 // Function pointer types for custom behavior
 typedef void (*MonsterDrawHeartsFunc)(Monster *monster, float screen_pos_x, float screen_pos_y);
-typedef void (*MonsterUpdateFunc)(Monster *monster);
 typedef void (*MonsterCleanupFunc)(Monster *monster);
+typedef void (*MonsterInitFunc)(Monster *monster);
+
+typedef enum
+{
+    MONSTER_BAT,
+    MONSTER_SLUG,
+    MONSTER_CRAB,
+    MONSTER_DRAGON,
+    MONSTER_BABY_DRAGON,
+    MONSTER_BOSS,
+    MONSTER_ARCHETYPE_COUNT
+} MonsterArchetypeId;
+
+// What a monster does on top of patrolling. Monsters of each kind are updated together in
+// one batch (see monster_list_update_behaviors).
+typedef enum
+{
+    MONSTER_BEHAVIOR_PATROL, // Patrol only
+    MONSTER_BEHAVIOR_DRAGON, // Fire at the target when in range (dragon.c)
+    MONSTER_BEHAVIOR_COUNT
+} MonsterBehavior;
+
+// What every monster of one kind shares
+typedef struct
+{
+    const char *texture_name;
+    const char *type; // Loot table key (e.g., "bat", "dragon")
+
+    MonsterBehavior behavior;
+
+    // Custom behavior function pointers
+    MonsterDrawHeartsFunc draw_hearts; // Heart drawing function
+    MonsterInitFunc custom_init;       // Sets up custom_data for a new monster
+    MonsterCleanupFunc custom_cleanup; // Custom cleanup logic
+
+    // Filled in by monster_archetypes_load and monster_archetypes_bind_loot
+    TextureHandle texture;
+    TextureHandle dead_texture;
+    TextureHandle filled_heart_texture;
+    TextureHandle empty_heart_texture;
+    LootTable *loot_table;
+} MonsterArchetype;
 
 typedef struct Monster
 {
@@ -17,50 +64,115 @@ typedef struct Monster
     Vector2 velocity;
     float width;
     float height;
-    Texture2D texture;
-    Texture2D dead_texture;
     float dead_texture_timer; // Timer to show dead texture before removal
     float scale;
     int hearts;
     int max_hearts;
-    float patrol_left_bound;        // Left boundary for patrolling
-    float patrol_right_bound;       // Right boundary for patrolling
-    float patrol_speed;             // Speed of movement
-    bool active;                    // Whether monster is active
-    Texture2D filled_heart_texture; // Filled heart texture
-    Texture2D empty_heart_texture;  // Empty heart texture
-
-    // Custom behavior function pointers
-    MonsterDrawHeartsFunc draw_hearts; // Custom heart drawing function
-    MonsterUpdateFunc custom_update;   // Custom update logic
-    MonsterCleanupFunc custom_cleanup; // Custom cleanup logic
-    void *custom_data;                 // Pointer for custom data specific to monster type
-    const char *type;                  // Monster type identifier for loot lookup (e.g., "skeleton", "dragon")
+    float patrol_left_bound;      // Left boundary for patrolling
+    float patrol_right_bound;     // Right boundary for patrolling
+    float patrol_speed;           // Speed of movement
+    bool active;                  // Whether monster is active
+    MonsterArchetypeId archetype; // Shared textures, behavior and loot table
+    void *custom_data;            // Pointer for custom data specific to monster type
 } Monster;
 
+// Everything about a monster that the per-tick update and collision passes do not touch
 typedef struct
 {
-    Monster *monsters;
+    float scale;
+    int max_hearts;
+    MonsterArchetypeId archetype;
+    void *custom_data;
+} MonsterCold;
+
+// Indices of the monsters of one behavior kind, in the order they were added
+typedef struct
+{
+    int *indices;
     int count;
     int capacity;
+} MonsterBatch;
+
+// Monsters are stored split: one array per hot field, indexed like the list, plus a cold
+// record per monster. Monster is still how monsters are defined and what custom behavior
+// sees; monster_list_get and monster_list_set convert between the two.
+// Monsters only patrol sideways, so no vertical velocity is stored. A patrol is a function
+// of the level time (see periodic.h) that starts from where the monster was set, at time 0.
+typedef struct
+{
+    // Hot: read or written every tick by the patrol update and collision passes
+    float *x;
+    float *previous_x; // Before the last update (for render interpolation)
+    float *y;
+    float *velocity_x; // At the last patrol evaluation
+    float *width;
+    float *height;
+    PatrolPath *patrol;
+    float *dead_texture_timer;
+    int *hearts;
+    bool *active;
+    float *think_owed; // Time since the monster last thought (see think_schedule.h)
+    float *think_dt;   // Step the monster thinks with this tick; 0 = not thinking
+
+    // Cold
+    MonsterCold *cold;
+
+    MonsterBatch batches[MONSTER_BEHAVIOR_COUNT]; // Monsters grouped by behavior kind
+
+    unsigned int think_tick; // Ticks scheduled since the last reset
+    int thinking;            // Monsters that thought in the last update
+
+    int count;
+    int capacity;
+    SlotTable slots; // Handles, as in the other slot maps (see slot_map.h)
 } MonsterList;
 
+// Archetype registry. Load acquires each archetype's textures once; bind points each
+// archetype at its loot table (the system's tables must not change afterwards).
+void monster_archetypes_load(void);
+void monster_archetypes_unload(void);
+void monster_archetypes_bind_loot(LootSystem *system);
+const MonsterArchetype *monster_archetype(MonsterArchetypeId id);
+
 // Monster functions
 Monster monster_create(float x, float y, float width, float height, int max_hearts,
                        float left_bound, float right_bound, float patrol_speed,
-                       const char *texture_path, float scale, const char *type);
-void monster_update(Monster *monster);
+                       MonsterArchetypeId archetype, float scale);
 void monster_draw(Monster *monster, float camera_x);
-void monster_take_damage(Monster *monster, int damage);
-bool monster_check_collision(Monster *monster, Rectangle player_rect);
 void monster_cleanup(Monster *monster);
 
 // Default heart drawing function
 void monster_draw_hearts_default(Monster *monster, float screen_pos_x, float screen_pos_y);
 
 // Monster list functions
+// Same operations as the other slot maps, applied to every array at once
 MonsterList monster_list_create(int capacity);
-void monster_list_add(MonsterList *list, Monster monster);
+SlotHandle monster_list_add(MonsterList *list, Monster monster);
+void monster_list_remove_at(MonsterList *list, int index);
+bool monster_list_remove(MonsterList *list, SlotHandle handle);
+int monster_list_find(const MonsterList *list, SlotHandle handle); // Index, or -1 if removed
 void monster_list_cleanup(MonsterList *list);
 
+// Per-index access to a stored monster. get assembles a copy; set writes one back.
+Monster monster_list_get(const MonsterList *list, int index);
+void monster_list_set(MonsterList *list, int index, const Monster *monster);
+Rectangle monster_list_rect(const MonsterList *list, int index);
+void monster_list_take_damage(MonsterList *list, int index, int damage);
+
+// Decide which monsters think this tick by their distance from camera_x, then put those where
+// their patrol is at time (level seconds). Far-off monsters think less often or not at all
+// (see think_schedule.h); when they do, they are straight back on their patrol.
+void monster_list_update(MonsterList *list, float camera_x, double time, float delta_time);
+
+// Run each behavior kind's batch after monster_list_update, for the monsters that think this
+// tick. Dragons fire into projectiles at target_pos; their cooldowns run on timers.
+void monster_list_update_behaviors(MonsterList *list, ProjectileList *projectiles, Vector2 target_pos, TimerWheel *timers);
+
+// Back to level time 0: every monster at the start of its patrol, and the think schedule
+// started over (no monster owes time and the tick count is 0)
+void monster_list_restart(MonsterList *list);
+
+// Draw every monster in the list
+void monster_list_draw(const MonsterList *list, float camera_x, float alpha); // alpha = fraction of a tick to interpolate
+
 #endif // MONSTER_H
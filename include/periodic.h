@@ -0,0 +1,43 @@
+#ifndef PERIODIC_H
+#define PERIODIC_H
+
+#include <stdbool.h>
+
+// Closed-form periodic motion: patrol paths and fade cycles as pure functions of time.
+//
+// Nothing here keeps state between calls. The value at any time comes straight from the
+// time, so an owner only evaluates when it needs the result (something is drawn or may
+// collide), skipping ticks costs nothing, and starting over is evaluating at time 0.
+// Time is in seconds of the level clock; it is a double so a long session keeps sub-pixel
+// precision.
+
+// Back and forth between two bounds. The first leg runs from origin_x at origin_velocity
+// until it reaches a bound; from there the path bounces between the bounds at speed.
+// An origin outside the bounds starts at the nearest bound. An origin_velocity of 0
+// keeps the path at origin_x.
+typedef struct
+{
+    float origin_x;        // Position at time 0
+    float origin_velocity; // Velocity of the first leg
+    float left_bound;
+    float right_bound;
+    float speed; // Speed between the bounds after the first leg
+} PatrolPath;
+
+// Position at time; the velocity there is written to *velocity unless it is NULL
+float patrol_path_x(const PatrolPath *path, double time, float *velocity);
+
+// Opaque, fade out, stay faded out, fade in, and again. Any phase may last 0 seconds.
+typedef struct
+{
+    float opaque_duration;
+    float fade_out_duration;
+    float faded_out_duration;
+    float fade_in_duration;
+} FadeCycle;
+
+// Opacity at time (0 = invisible, 1 = fully visible). *faded_out is set from the start of
+// the fade out until the fade in starts.
+float fade_cycle_opacity(const FadeCycle *cycle, double time, bool *faded_out);
+
+#endif // PERIODIC_H
@@ -2,6 +2,11 @@
 #define PICKUP_H
 
 #include "raylib.h"
+#include "texture_cache.h"
+#include "body_batch.h"
+#include "slot_map.h"
+#include "timer_wheel.h"
+#include "sector.h"
 
 typedef enum
 {
@@ -11,26 +16,37 @@ typedef enum
 typedef struct
 {
     Vector2 position;
+    Vector2 previous_position; // Position before the last update (for render interpolation)
     Vector2 velocity;
     float width;
     float height;
     float speed;
-    Texture2D texture;
+    TextureHandle texture;
     float scale;
     PickupType type;
     bool active;
     float lifetime;
     float max_lifetime;
     float rotation;
-    int value; // How much this pickup gives (e.g., projectiles added)
+    int value;   // How much this pickup gives (e.g., projectiles added)
+    int spawner; // Index of the spawner that made it in the level's spawner list, or -1
 } Pickup;
 
+typedef struct
+{
+    SLOT_MAP_FIELDS(Pickup, pickups)
+} PickupList;
+
+// Spare pickups waiting to be spawned again. Each one keeps its texture reference, so
+// respawning one only resets its state.
 typedef struct
 {
     Pickup *pickups;
     int count;
     int capacity;
-} PickupList;
+} PickupPool;
+
+#define PICKUP_SPAWNER_DEFAULT_MAX_LIVE 4
 
 // Pickup spawner configuration for flexible spawning of different pickup types
 typedef struct
@@ -39,8 +55,11 @@ typedef struct
     PickupType type;        // What type of pickup to spawn
     int value;              // Value of spawned pickups (e.g., projectiles)
     float spawn_interval;   // Time between spawns
-    float spawn_timer;      // Current spawn timer
+    TimerHandle spawn_timer; // Pending until the next spawn is due (world timers)
     bool enabled;           // Whether this spawner is active
+    int max_live;           // Most pickups from this spawner alive at once; the timer waits when reached
+    int live_count;         // Pickups from this spawner currently in the level
+    bool prewarm;           // Fill the pool with max_live pickups when the level loads
 } PickupSpawner;
 
 typedef struct
@@ -52,17 +71,45 @@ typedef struct
 
 // Pickup functions
 Pickup pickup_create(PickupType type, Vector2 spawn_pos, int value);
-void pickup_update(Pickup *pickup);
 void pickup_draw(Pickup *pickup, float camera_x);
-PickupList pickup_list_create(int capacity);
-void pickup_list_add(PickupList *list, Pickup pickup);
-void pickup_list_cleanup(PickupList *list);
+
+// Pickup list: pickup_list_create, pickup_list_add, ... (see slot_map.h)
+SLOT_MAP_DECLARE(PickupList, Pickup, pickup_list)
+
+// Move every active pickup in an awake sector one step (bodies is scratch space); pickups in
+// sleeping sectors stay frozen. Pickups far outside the view around camera_x despawn.
+// Returns how many were frozen.
+int pickup_list_update(PickupList *list, BodyBatch *bodies, const SectorWindow *awake, float camera_x, float delta_time);
+
+// Move the pickups that are no longer active (expired or collected) from the list to the
+// pool, and give their spawners room to spawn again
+void pickup_list_recycle(PickupList *list, PickupSpawnerList *spawners, PickupPool *pool);
+
+// Pool functions
+PickupPool pickup_pool_create(int capacity);
+void pickup_pool_cleanup(PickupPool *pool);
+
+// Put a finished pickup in the pool; the pool takes over its texture reference
+void pickup_pool_put(PickupPool *pool, Pickup pickup);
+
+// A fresh pickup of the given type: a pooled one when available, otherwise a new one
+Pickup pickup_pool_take(PickupPool *pool, PickupType type, Vector2 spawn_pos, int value);
+
+// Create the pickups each prewarming spawner may have alive, so spawning never loads
+void pickup_pool_prewarm(PickupPool *pool, PickupSpawnerList *spawners);
 
 // Spawner functions
 PickupSpawner pickup_spawner_create(PickupType type, Vector2 location, int value, float interval);
 PickupSpawnerList pickup_spawner_list_create(int capacity);
 void pickup_spawner_list_add(PickupSpawnerList *list, PickupSpawner spawner);
 void pickup_spawner_list_cleanup(PickupSpawnerList *list);
-void pickup_spawner_update(PickupSpawner *spawner, PickupList *pickup_list);
+// Spawn from every spawner in an awake sector whose timer is done and that has room, and
+// restart its timer. Sleeping spawners wait; one that came due while asleep spawns once when
+// it wakes. Returns how many spawners slept.
+int pickup_spawner_list_update(PickupSpawnerList *spawners, PickupList *pickup_list, PickupPool *pool, TimerWheel *timers,
+                               const SectorWindow *awake);
+
+// Start every spawner's timer from a full interval
+void pickup_spawner_list_restart(PickupSpawnerList *spawners, TimerWheel *timers);
 
 #endif // PICKUP_H
@@ -0,0 +1,31 @@
+#ifndef PLAYER_INPUT_H
+#define PLAYER_INPUT_H
+
+#include "raylib.h"
+
+// Everything the simulation needs from the player for one tick. The windowed game fills
+// this from the keyboard and mouse; headless runs and replays fill it themselves.
+typedef struct
+{
+    // Held controls (state for the whole tick)
+    bool move_left;
+    bool move_right;
+    bool duck;
+    bool sword;
+
+    // Edge-triggered actions (pressed since the last tick that consumed them)
+    bool jump;
+    bool use_health_potion;
+    bool use_protection_potion;
+    bool fire;
+    Vector2 fire_target; // World-space point the fireball is aimed at
+} PlayerInput;
+
+// Merge a freshly sampled frame into the pending input. Held controls are replaced, presses
+// are kept until a tick consumes them so none are lost when a frame runs zero ticks.
+void player_input_accumulate(PlayerInput *pending, PlayerInput frame);
+
+// Clear the edge-triggered actions once a tick has applied them
+void player_input_consume_presses(PlayerInput *input);
+
+#endif // PLAYER_INPUT_H
@@ -0,0 +1,71 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+
+// Frame profiler: named timing zones summed per rendered frame into a ring buffer.
+//
+// Zones are only compiled in when KNIGHT_PROFILER is defined (CMake option of the same name).
+// Without it PROFILE_* expand to nothing, so instrumented code costs exactly what it did before.
+//
+//     PROFILE_ZONE_BEGIN(PROFILE_ZONE_HAZARDS);
+//     ...
+//     PROFILE_ZONE_END(PROFILE_ZONE_HAZARDS);
+//
+// A zone entered several times in one frame (e.g. once per simulation tick) adds up.
+// While a trace is running (trace.h) every zone and frame also becomes a timeline event.
+
+typedef enum
+{
+    PROFILE_ZONE_INPUT,
+    PROFILE_ZONE_HAZARDS,
+    PROFILE_ZONE_PLAYER,
+    PROFILE_ZONE_MONSTERS,
+    PROFILE_ZONE_DRAGON_AI, // Behavior batches (dragons cooling down and firing)
+    PROFILE_ZONE_PROJECTILES,
+    PROFILE_ZONE_PICKUPS,   // Pickups, spawners and loot movement
+    PROFILE_ZONE_BROADPHASE,   // Collision proxies, pairs and candidates
+    PROFILE_ZONE_NARROW_PHASE, // Testing the candidates (on the contact threads when there are many)
+    PROFILE_ZONE_RESOLVE,      // Turning contacts into events
+    PROFILE_ZONE_EVENTS,       // Applying the events
+    PROFILE_ZONE_DRAW_BACKGROUND,
+    PROFILE_ZONE_DRAW_ENTITIES,
+    PROFILE_ZONE_DRAW_UI,
+    PROFILE_ZONE_PRESENT, // EndDrawing: buffer swap and vsync wait
+    PROFILE_ZONE_COUNT
+} ProfileZone;
+
+#define PROFILER_HISTORY 600 // Frames kept (ten seconds at 60 FPS)
+
+typedef struct
+{
+    unsigned long long frame_ns;                    // Start of this frame to start of the next
+    unsigned long long zone_ns[PROFILE_ZONE_COUNT]; // Time spent in each zone this frame
+} ProfileFrame;
+
+#ifdef KNIGHT_PROFILER
+#define PROFILE_FRAME_BEGIN() profiler_frame_begin()
+#define PROFILE_ZONE_BEGIN(zone) unsigned long long profile_start_##zone = profiler_zone_begin(zone)
+#define PROFILE_ZONE_END(zone) profiler_zone_end(zone, profile_start_##zone)
+#else
+#define PROFILE_FRAME_BEGIN() ((void)0)
+#define PROFILE_ZONE_BEGIN(zone) ((void)0)
+#define PROFILE_ZONE_END(zone) ((void)0)
+#endif
+
+// Close the previous frame and start collecting a new one. Call once at the top of the main loop.
+void profiler_frame_begin(void);
+
+unsigned long long profiler_zone_begin(ProfileZone zone);
+void profiler_zone_end(ProfileZone zone, unsigned long long start);
+
+// Completed frames, newest first (frames_ago 0 = the last finished frame). NULL past the history.
+const ProfileFrame *profiler_frame(int frames_ago);
+int profiler_frame_count(void);
+
+const char *profiler_zone_name(ProfileZone zone);
+
+// Write the recorded history, oldest frame first, as CSV with one millisecond column per zone
+bool profiler_write_csv(const char *path);
+
+#endif // PROFILER_H
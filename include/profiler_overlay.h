@@ -0,0 +1,8 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+// Draw the profiler panel (per-zone bars and a rolling frame-time graph) with its top-left
+// corner at x, y. Uses the frames recorded by profiler.c.
+void profiler_overlay_draw(int x, int y);
+
+#endif // PROFILER_OVERLAY_H
@@ -2,11 +2,15 @@
 #define PROJECTILE_H
 
 #include "raylib.h"
+#include "texture_cache.h"
+#include "body_batch.h"
+#include "slot_map.h"
 
 typedef enum
 {
-    PROJECTILE_FIREBALL
+    PROJECTILE_FIREBALL,
     // Future projectile types can be added here (PROJECTILE_LIGHTNING, etc.)
+    PROJECTILE_TYPE_COUNT
 } ProjectileType;
 
 typedef enum
@@ -15,38 +19,59 @@ typedef enum
     PROJECTILE_SOURCE_MONSTER
 } ProjectileSource;
 
+// Properties shared by every projectile of one type
 typedef struct
 {
-    Vector2 position;
-    Vector2 velocity;
+    const char *texture_name;
+    TextureHandle texture; // Acquired by projectile_archetypes_load
     float speed;
     float width;
     float height;
-    Texture2D texture;
     float scale;
-    ProjectileType type;
-    ProjectileSource source; // Who fired this projectile
+    float max_lifetime; // Lifetime of a new projectile
+} ProjectileArchetype;
+
+// Per-projectile state only; everything else comes from the archetype
+typedef struct
+{
+    Vector2 position;
+    Vector2 previous_position; // Position before the last update (for swept collision)
+    Vector2 velocity;
+    float lifetime;       // Time remaining for the projectile to live
+    unsigned char type;   // ProjectileType, indexes the archetype table
+    unsigned char source; // ProjectileSource: who fired this projectile
     bool active;
-    float lifetime;     // Time remaining for the projectile to live
-    float max_lifetime; // Maximum lifetime before despawning
 } Projectile;
 
 typedef struct
 {
-    Projectile *projectiles;
-    int count;
-    int capacity;
+    SLOT_MAP_FIELDS(Projectile, projectiles)
 } ProjectileList;
 
+// Archetype table: load acquires each type's texture once, so firing never touches the
+// texture cache. Unload releases them again.
+void projectile_archetypes_load(void);
+void projectile_archetypes_unload(void);
+const ProjectileArchetype *projectile_archetype(ProjectileType type);
+
 // Projectile functions
+Projectile projectile_create(ProjectileType type, Vector2 start_pos, Vector2 target_pos, ProjectileSource source);
 Projectile projectile_create_fireball(Vector2 start_pos, Vector2 target_pos, ProjectileSource source);
-void projectile_update(Projectile *projectile);
 void projectile_draw(Projectile *projectile, float camera_x);
-bool projectile_check_player_collision(Projectile *projectile, Rectangle player_rect);
+bool projectile_check_player_collision(const Projectile *projectile, Rectangle player_from, Rectangle player_to);
+
+// Test the projectile's path this step against a target moving from target_from to
+// target_to. time_of_impact gets the fraction of the step at first contact.
+bool projectile_check_swept_collision(const Projectile *projectile, Rectangle target_from, Rectangle target_to, float *time_of_impact);
+
+// Area the projectile covered during the last step
+Rectangle projectile_swept_bounds(const Projectile *projectile);
+
+// Projectile list: projectile_list_create, projectile_list_add, ... (see slot_map.h)
+SLOT_MAP_DECLARE(ProjectileList, Projectile, projectile_list)
 
-// Projectile list functions
-ProjectileList projectile_list_create(int capacity);
-void projectile_list_add(ProjectileList *list, Projectile projectile);
-void projectile_list_cleanup(ProjectileList *list);
+// Move every active projectile one step (bodies is scratch space), then remove the ones
+// that are no longer active. Projectiles far outside the view around camera_x despawn.
+void projectile_list_update(ProjectileList *list, BodyBatch *bodies, float camera_x, float delta_time);
 
 #endif // PROJECTILE_H
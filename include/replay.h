@@ -0,0 +1,57 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "player_input.h"
+#include <stdio.h>
+
+// Input recordings: everything needed to reproduce a play session tick for tick.
+//
+// File layout (little-endian):
+//   header  "KTVR", u16 version, u32 RNG seed, u16 start level (0-based), u16 tick rate
+//   runs    repeated until end of file:
+//             u8  input flags (see replay.c)
+//             u8  control flags (pause menu open)
+//             f32 fire target x, f32 fire target y   (only when the fire flag is set)
+//             varint number of consecutive ticks with this exact input
+//
+// Only ticks where the simulation is active are stored. Level transitions are implied:
+// a tick recorded while the state is on the transition screen means the player moved on.
+
+#define REPLAY_VERSION 1
+
+typedef struct
+{
+    PlayerInput input;
+    bool pause_menu_active; // Pause menu open: the world is frozen but game timers keep running
+} ReplayTick;
+
+typedef struct
+{
+    FILE *file;
+    ReplayTick run_tick;     // Tick currently being run-length encoded
+    unsigned int run_length; // Number of ticks in the current run (0 = no run yet)
+    long tick_count;         // Total ticks recorded
+} ReplayRecorder;
+
+typedef struct
+{
+    FILE *file;
+    unsigned int seed;          // RNG seed the session was recorded with
+    int start_level;            // Level index the session started on
+    int tick_rate;              // Simulation tick rate at recording time
+    ReplayTick run_tick;        // Tick being repeated
+    unsigned int run_remaining; // Ticks left in the current run
+    long tick_count;            // Ticks played back so far
+} ReplayPlayer;
+
+// Recording. open writes the header; close flushes the last run.
+bool replay_recorder_open(ReplayRecorder *recorder, const char *path, unsigned int seed, int start_level);
+void replay_recorder_write(ReplayRecorder *recorder, const ReplayTick *tick);
+void replay_recorder_close(ReplayRecorder *recorder);
+
+// Playback. open reads and validates the header; next returns false once the stream ends.
+bool replay_player_open(ReplayPlayer *player, const char *path);
+bool replay_player_next(ReplayPlayer *player, ReplayTick *tick);
+void replay_player_close(ReplayPlayer *player);
+
+#endif // REPLAY_H
@@ -0,0 +1,53 @@
+#ifndef SECTOR_H
+#define SECTOR_H
+
+#include <stdbool.h>
+#include "config.h"
+
+// Sleep and wake regions for the level simulation.
+//
+// A level is cut into fixed-width sectors along X (SIM_SECTOR_WIDTH, sector 0 starting at
+// x = 0; negative x falls into negative sectors). Each tick the sectors within
+// SIM_SECTOR_RADIUS of the camera's sector are awake and everything else sleeps. Owners
+// decide what sleeping means for their entities: pickups and loot stay frozen, spawners
+// hold their spawn, and hazards (level clock) and monsters (think schedule) catch up from
+// the time when they wake.
+
+typedef struct
+{
+    int first; // First awake sector
+    int last;  // Last awake sector
+    float min_x; // Left edge of the first awake sector
+    float max_x; // Right edge of the last awake sector
+} SectorWindow;
+
+// What the sector window left out in one tick, for the debug overlay and benchmarks
+typedef struct
+{
+    int active_sectors;
+    int hazards_skipped;  // Not registered with the broadphase
+    int monsters_skipped; // Did not think
+    int pickups_skipped;  // Frozen
+    int loot_skipped;     // Frozen
+    int spawners_skipped; // Did not check their timer
+} SectorStats;
+
+// Sector that contains x
+int sector_of(float x);
+
+// The sectors within radius of the camera's sector
+SectorWindow sector_window(float camera_x, int radius);
+
+// Number of awake sectors
+int sector_window_count(const SectorWindow *window);
+
+// Whether x lies in an awake sector
+bool sector_window_contains(const SectorWindow *window, float x);
+
+// Whether any part of [min_x, max_x] lies in an awake sector
+bool sector_window_overlaps(const SectorWindow *window, float min_x, float max_x);
+
+// Entities skipped in total
+int sector_stats_skipped(const SectorStats *stats);
+
+#endif // SECTOR_H
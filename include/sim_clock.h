@@ -0,0 +1,8 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+// Monotonic nanosecond clock that works without a window (raylib's GetTime() needs one).
+// Only differences between two readings are meaningful.
+unsigned long long sim_clock_ns(void);
+
+#endif // SIM_CLOCK_H
@@ -0,0 +1,145 @@
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Slot maps: packed arrays of items that can be added and removed in O(1) and referred to
+// by handles that notice when their item is gone.
+//
+// Items always sit in items[0..count), so loops stay plain array loops. Removing an item
+// moves the last one into its place, which changes the order. A handle names a slot
+// rather than a position; each slot remembers where its item currently is and counts how
+// often it has been emptied (its generation), so a handle to a removed item never finds
+// the slot's next item. Freed slots and positions are reused, so memory only grows to the
+// most items ever alive at once.
+
+typedef struct
+{
+    int slot;
+    unsigned int generation;
+} SlotHandle;
+
+#define SLOT_HANDLE_NONE ((SlotHandle){-1, 0})
+
+// Handle bookkeeping shared by every slot map
+typedef struct
+{
+    int *item_index;          // Per slot: position of its item
+    unsigned int *generation; // Per slot: bumped every time its item is removed
+    int *slot_of;             // Per position: slot of the item there
+    int *free_slots;          // Stack of unused slots
+    int free_count;
+    int slot_count; // Slots handed out so far
+    int capacity;   // Slots and positions allocated
+} SlotTable;
+
+void slot_table_reserve(SlotTable *table, int capacity);
+SlotHandle slot_table_insert(SlotTable *table, int index);
+void slot_table_remove(SlotTable *table, int index, int last);
+int slot_table_find(const SlotTable *table, SlotHandle handle); // -1 if the item is gone
+SlotHandle slot_table_handle(const SlotTable *table, int index);
+void slot_table_clear(SlotTable *table, int count);
+void slot_table_cleanup(SlotTable *table);
+
+// Hook for items that need no preparation or release
+#define SLOT_MAP_NO_HOOK(item) ((void)(item))
+
+// Put these first in the list struct. items names the item array (e.g. hazards).
+#define SLOT_MAP_FIELDS(Type, items) \
+    Type *items;                     \
+    int count;                       \
+    int capacity;                    \
+    SlotTable slots;
+
+// Prototypes for a slot map type, in the header
+#define SLOT_MAP_DECLARE(Name, Type, prefix)                      \
+    Name prefix##_create(int capacity);                           \
+    SlotHandle prefix##_add(Name *map, Type item);                \
+    void prefix##_remove_at(Name *map, int index);                \
+    bool prefix##_remove(Name *map, SlotHandle handle);           \
+    Type *prefix##_get(Name *map, SlotHandle handle);             \
+    SlotHandle prefix##_handle(const Name *map, int index);       \
+    void prefix##_clear(Name *map);                               \
+    void prefix##_cleanup(Name *map);
+
+// Function bodies for a slot map type, in one source file. prepare(Type *) runs on an item
+// as it is added, release(Type *) on every item as it leaves the map (removed, cleared or
+// cleaned up); pass SLOT_MAP_NO_HOOK for either when nothing is needed.
+#define SLOT_MAP_DEFINE(Name, Type, items, prefix, prepare, release)                  \
+    Name prefix##_create(int capacity)                                                 \
+    {                                                                                  \
+        Name map = {0};                                                                \
+        map.items = (Type *)malloc(sizeof(Type) * (capacity > 0 ? capacity : 1));      \
+        map.capacity = capacity;                                                       \
+        slot_table_reserve(&map.slots, capacity);                                      \
+        return map;                                                                    \
+    }                                                                                  \
+                                                                                       \
+    SlotHandle prefix##_add(Name *map, Type item)                                      \
+    {                                                                                  \
+        if (map->count >= map->capacity)                                               \
+        {                                                                              \
+            int capacity = map->capacity > 0 ? map->capacity * 2 : 8;                  \
+            map->items = (Type *)realloc(map->items, sizeof(Type) * capacity);         \
+            map->capacity = capacity;                                                  \
+            slot_table_reserve(&map->slots, capacity);                                 \
+        }                                                                              \
+        prepare(&item);                                                                \
+        map->items[map->count] = item;                                                 \
+        return slot_table_insert(&map->slots, map->count++);                           \
+    }                                                                                  \
+                                                                                       \
+    void prefix##_remove_at(Name *map, int index)                                      \
+    {                                                                                  \
+        int last = --map->count;                                                       \
+        release(&map->items[index]);                                                   \
+        slot_table_remove(&map->slots, index, last);                                   \
+        if (index != last)                                                             \
+            map->items[index] = map->items[last];                                      \
+    }                                                                                  \
+                                                                                       \
+    bool prefix##_remove(Name *map, SlotHandle handle)                                 \
+    {                                                                                  \
+        int index = slot_table_find(&map->slots, handle);                              \
+        if (index < 0)                                                                 \
+            return false;                                                              \
+        prefix##_remove_at(map, index);                                                \
+        return true;                                                                   \
+    }                                                                                  \
+                                                                                       \
+    Type *prefix##_get(Name *map, SlotHandle handle)                                   \
+    {                                                                                  \
+        int index = slot_table_find(&map->slots, handle);                              \
+        return index >= 0 ? &map->items[index] : NULL;                                 \
+    }                                                                                  \
+                                                                                       \
+    SlotHandle prefix##_handle(const Name *map, int index)                             \
+    {                                                                                  \
+        return slot_table_handle(&map->slots, index);                                  \
+    }                                                                                  \
+                                                                                       \
+    void prefix##_clear(Name *map)                                                     \
+    {                                                                                  \
+        for (int i = 0; i < map->count; i++)                                           \
+        {                                                                              \
+            release(&map->items[i]);                                                   \
+        }                                                                              \
+        slot_table_clear(&map->slots, map->count);                                     \
+        map->count = 0;                                                                \
+    }                                                                                  \
+                                                                                       \
+    void prefix##_cleanup(Name *map)                                                   \
+    {                                                                                  \
+        if (map->items)                                                                \
+        {                                                                              \
+            prefix##_clear(map);                                                       \
+            free(map->items);                                                          \
+            map->items = NULL;                                                         \
+        }                                                                              \
+        slot_table_cleanup(&map->slots);                                               \
+        map->count = 0;                                                                \
+        map->capacity = 0;                                                             \
+    }
+
+#endif // SLOT_MAP_H
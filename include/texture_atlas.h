@@ -0,0 +1,27 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include "raylib.h"
+
+// Atlas page settings
+#define TEXTURE_ATLAS_PAGE_SIZE 4096 // Width/height limit of one atlas page in pixels
+#define TEXTURE_ATLAS_MAX_PAGES 4    // Sprites that don't fit fall back to standalone textures
+#define TEXTURE_ATLAS_MAX_SPRITES 64
+#define TEXTURE_ATLAS_PADDING 2 // Transparent gap between sprites to avoid sampling neighbours
+
+// Pack every PNG in the assets directory into as few textures as possible.
+// Must be called after InitWindow() and before any texture is acquired from the cache.
+// Returns the number of sprites packed (0 if nothing could be packed).
+int texture_atlas_build(void);
+
+// Find a packed sprite by asset filename (e.g. "bat.png").
+// On success fills in the page texture and the sprite's source rectangle in that page.
+bool texture_atlas_find(const char *asset_name, Texture2D *page, Rectangle *source);
+
+// Number of atlas pages currently loaded
+int texture_atlas_page_count(void);
+
+// Unload all atlas pages. Call before CloseWindow().
+void texture_atlas_unload(void);
+
+#endif // TEXTURE_ATLAS_H
@@ -0,0 +1,54 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include "raylib.h"
+
+// Small integer handle into the shared texture registry.
+// 0 is never a valid handle, so zero-initialized structs start with "no texture".
+// The low bits name the registry slot and the rest count how often that slot was freed
+// (as slot map handles do), so a handle kept past its last release never finds the
+// texture loaded into the slot afterwards.
+typedef int TextureHandle;
+
+#define TEXTURE_HANDLE_INVALID 0
+#define TEXTURE_CACHE_MAX_ENTRIES 64
+
+// A drawable image: the texture it lives in and its source rectangle within that texture.
+// When the atlas is built, most sprites share one texture and differ only in source.
+typedef struct
+{
+    Texture2D texture;
+    Rectangle source;
+} Sprite;
+
+// Get a handle for an asset, loading it from disk only on first use.
+// Assets packed by texture_atlas_build() resolve to their atlas region instead.
+// The name may be a bare filename ("bat.png") or a path into assets ("../assets/bat.png");
+// both resolve to the same entry. Each acquire must be paired with a release.
+TextureHandle texture_cache_acquire(const char *asset_name);
+
+// Headless mode for running the simulation without a GL context: no textures are created,
+// but each entry still records the image size (read from the file) so entity sizes and
+// hitboxes match the windowed game. Enable before acquiring anything.
+void texture_cache_set_headless(bool enabled);
+
+// Drop one reference; the texture is unloaded when the last reference goes away
+void texture_cache_release(TextureHandle handle);
+
+// Look up the sprite for a handle. Returns an empty sprite (texture id 0) for invalid handles.
+Sprite texture_cache_get_sprite(TextureHandle handle);
+
+// Sprite versions of DrawTextureEx and DrawTexturePro (source rectangle taken from the sprite)
+void sprite_draw_ex(Sprite sprite, Vector2 position, float rotation, float scale, Color tint);
+void sprite_draw_pro(Sprite sprite, Rectangle dest, Vector2 origin, float rotation, Color tint);
+
+// Number of textures currently resident (for debugging and tests)
+int texture_cache_loaded_count(void);
+
+// Current reference count of a handle (0 if invalid or unloaded)
+int texture_cache_ref_count(TextureHandle handle);
+
+// Unload everything regardless of reference counts, including the atlas. Call before CloseWindow().
+void texture_cache_shutdown(void);
+
+#endif // TEXTURE_CACHE_H
@@ -0,0 +1,37 @@
+#ifndef THINK_SCHEDULE_H
+#define THINK_SCHEDULE_H
+
+#include "config.h"
+
+// Think-rate level of detail for monster AI.
+//
+// How often an agent thinks depends on its horizontal distance from the camera:
+//   near (< AI_NEAR_DISTANCE):    every tick
+//   mid  (< AI_MID_DISTANCE):     AI_MID_THINK_RATE times a second
+//   dormant (further):            never; the agent is frozen where it is
+//
+// A mid-band agent thinks on ticks where (tick + index) is a multiple of the think interval,
+// so the mid band is spread evenly over the interval instead of all thinking on one tick.
+// Time that passes between thinks is owed to the agent and handed over as one longer step
+// the next time it thinks. Dormant agents owe nothing. Everything depends only on the tick
+// number and positions, so a fixed-timestep run schedules the same way every time.
+
+typedef enum
+{
+    THINK_BAND_NEAR,
+    THINK_BAND_MID,
+    THINK_BAND_DORMANT
+} ThinkBand;
+
+// Ticks between two thinks of a mid-band agent
+#define THINK_MID_INTERVAL (SIMULATION_TICK_RATE / AI_MID_THINK_RATE)
+
+ThinkBand think_band(float distance);
+
+// Schedule count agents at positions x for one tick of length delta_time. Writes each
+// agent's step for this tick to think_dt (0 = not thinking) and carries unspent time in owed.
+// Returns how many agents think this tick.
+int think_schedule(const float *x, int count, float camera_x, unsigned int tick, float delta_time,
+                   float *owed, float *think_dt);
+
+#endif // THINK_SCHEDULE_H
@@ -0,0 +1,89 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdbool.h>
+
+// Hierarchical timing wheel for gameplay timers and cooldowns.
+//
+// Time is counted in simulation ticks: advance the wheel once per tick. A timer sits in one
+// slot of one level until it is due, so a pending timer costs nothing per tick; only the
+// timers that expire are touched. Level 0 has one slot per tick for the next 64 ticks, and
+// each further level has slots 64 times as wide. When level 0 wraps around, the next slot of
+// level 1 is spread back over level 0 (and so on up), so every timer fires on exactly the
+// tick it was scheduled for. Timers further out than the wheel reaches (about 39 hours at
+// 120 Hz) fire at its far end.
+//
+// A timer either calls back when it expires or is just polled with timer_wheel_pending
+// (callback NULL). Timers due on the same tick fire in an order that depends only on the
+// schedule and cancel calls made, so a replayed run fires them the same way.
+// Handles carry a generation, so a handle to a timer that has fired or been cancelled is
+// simply no longer pending, even once its node has been reused.
+
+#define TIMER_WHEEL_LEVELS 4
+#define TIMER_WHEEL_SLOT_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+
+typedef void (*TimerCallback)(void *context, int arg);
+
+typedef struct
+{
+    int node;
+    unsigned int generation;
+} TimerHandle;
+
+#define TIMER_HANDLE_NONE ((TimerHandle){-1, 0})
+
+typedef struct
+{
+    unsigned int expires;    // Tick it fires on
+    TimerCallback callback;  // NULL = nothing runs, owners poll timer_wheel_pending
+    void *context;
+    int arg;
+    unsigned int generation; // Bumped every time the node fires, is cancelled or is freed
+    int bucket;              // Slot list it is in, or -1 when not scheduled
+    int prev;                // Neighbours in the slot list, or in the free list (next only)
+    int next;
+} TimerNode;
+
+typedef struct
+{
+    TimerNode *nodes;
+    int node_count; // Nodes handed out so far
+    int capacity;
+    int free_head; // First reusable node, or -1
+
+    int heads[TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS]; // First node of each slot list, or -1
+    int tails[TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS];
+
+    unsigned int now; // Ticks advanced so far
+    int pending;      // Timers scheduled and not yet fired or cancelled
+} TimerWheel;
+
+TimerWheel timer_wheel_create(int capacity);
+void timer_wheel_cleanup(TimerWheel *wheel);
+
+// Cancel every timer without firing it
+void timer_wheel_clear(TimerWheel *wheel);
+
+// Whole ticks for a duration in seconds, rounded up (at least 1)
+unsigned int timer_ticks(float seconds);
+
+// Fire after ticks more advances (at least 1)
+TimerHandle timer_wheel_schedule(TimerWheel *wheel, unsigned int ticks, TimerCallback callback, void *context, int arg);
+
+// Cancel *handle if it is still pending and schedule it again, storing the new handle
+void timer_wheel_restart(TimerWheel *wheel, TimerHandle *handle, unsigned int ticks, TimerCallback callback, void *context, int arg);
+
+// False when the timer had already fired or been cancelled
+bool timer_wheel_cancel(TimerWheel *wheel, TimerHandle handle);
+
+bool timer_wheel_pending(const TimerWheel *wheel, TimerHandle handle);
+
+// Seconds until the timer fires, 0 when it is not pending
+float timer_wheel_remaining(const TimerWheel *wheel, TimerHandle handle);
+
+// Move one tick on and fire what is due. Callbacks may schedule and cancel timers.
+// Returns how many timers fired.
+int timer_wheel_advance(TimerWheel *wheel);
+
+#endif // TIMER_WHEEL_H
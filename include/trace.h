@@ -0,0 +1,38 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+
+// Timeline tracing in the Chrome trace-event format (open in chrome://tracing or ui.perfetto.dev).
+//
+// Events are buffered in memory and written out by a background thread, so the game thread
+// only pays for a clock read and a copy. Like the profiler zones, TRACE_* compile to nothing
+// unless KNIGHT_PROFILER is defined; with it they cost one branch until trace_start is called.
+//
+// Names must be string literals (they are stored by pointer). The optional detail string is
+// copied and shows up as args.detail, e.g. the file behind a texture load.
+
+#define TRACE_DETAIL_LENGTH 96
+
+#ifdef KNIGHT_PROFILER
+#define TRACE_BEGIN(name) trace_begin(name, NULL)
+#define TRACE_BEGIN_DETAIL(name, detail) trace_begin(name, detail)
+#define TRACE_END(name) trace_end(name)
+#else
+#define TRACE_BEGIN(name) ((void)0)
+#define TRACE_BEGIN_DETAIL(name, detail) ((void)0)
+#define TRACE_END(name) ((void)0)
+#endif
+
+// Start writing events to path. Returns false if the file cannot be created.
+bool trace_start(const char *path);
+
+// Flush everything still buffered, finish the JSON and close the file
+void trace_stop(void);
+
+bool trace_is_active(void);
+
+void trace_begin(const char *name, const char *detail);
+void trace_end(const char *name);
+
+#endif // TRACE_H
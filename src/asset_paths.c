@@ -118,3 +118,12 @@ const char *get_asset_path(const char *filename)
 
     return full_path;
 }
+
+const char *get_asset_directory(void)
+{
+    if (asset_base_path[0] == '\0')
+    {
+        return "assets";
+    }
+    return asset_base_path;
+}
@@ -5,8 +5,16 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_CACHED_CHUNKS 10
-#define MAX_CACHED_CLOUDS 20
+#define LOOKAHEAD_CHUNKS 2          // Chunks generated ahead of the visible range in the direction of travel
+#define LOOKAHEAD_CLOUDS 2          // Clouds generated ahead of the visible range in the direction of travel
+#define FALLBACK_SCREEN_WIDTH 1280  // Used to size the caches when no window exists yet
+
+// Map a (possibly negative) index onto a direct-mapped cache slot
+static int cache_slot(int index, int slot_count)
+{
+    int slot = index % slot_count;
+    return slot < 0 ? slot + slot_count : slot;
+}
 
 // Simple pseudo-random number generator based on seed
 static float pseudo_random(int seed)
@@ -17,6 +25,34 @@ static float pseudo_random(int seed)
     return (float)(x & 0x7FFFFFFF) / 2147483647.0f;
 }
 
+// Convert a chunk's mountain points into cached world-space strips so drawing
+// needs no per-frame allocation or per-pixel fill lines
+static void build_mountain_mesh(BackgroundChunk *chunk)
+{
+    if (chunk->fill_strip)
+    {
+        free(chunk->fill_strip);
+    }
+    if (chunk->outline_strip)
+    {
+        free(chunk->outline_strip);
+    }
+
+    chunk->fill_strip_count = chunk->mountain_point_count * 2;
+    chunk->fill_strip = (Vector2 *)malloc(chunk->fill_strip_count * sizeof(Vector2));
+    chunk->outline_strip = (Vector2 *)malloc(chunk->mountain_point_count * sizeof(Vector2));
+
+    for (int i = 0; i < chunk->mountain_point_count; i++)
+    {
+        Vector2 peak = {chunk->mountain_points[i].x, chunk->mountain_points[i].y};
+
+        // Peak then ground keeps every strip triangle counter-clockwise on screen
+        chunk->fill_strip[i * 2] = peak;
+        chunk->fill_strip[i * 2 + 1] = (Vector2){peak.x, GROUND_Y};
+        chunk->outline_strip[i] = peak;
+    }
+}
+
 // Generate mountain points for a chunk using deterministic algorithm
 static void generate_mountain_chunk(BackgroundChunk *chunk, int chunk_index, float base_height, int seed_variant)
 {
@@ -55,40 +91,26 @@ static void generate_mountain_chunk(BackgroundChunk *chunk, int chunk_index, flo
         chunk->mountain_points[i] = (Vector3){x, current_height, 0.0f};
     }
 
+    build_mountain_mesh(chunk);
     chunk->generated = true;
 }
 
-// Get or create a chunk for a given index
+// Get or create a chunk for a given index. The cache is direct-mapped and sized
+// to hold the visible range plus look-ahead on both sides, so neighbouring
+// chunks never share a slot while scrolling
 static BackgroundChunk *get_chunk(Background *bg, int chunk_index)
 {
-    // Look for existing chunk
-    for (int i = 0; i < MAX_CACHED_CHUNKS; i++)
-    {
-        if (bg->chunks[i].generated && bg->chunks[i].chunk_index == chunk_index)
-        {
-            return &bg->chunks[i];
-        }
-    }
+    BackgroundChunk *chunk = &bg->chunks[cache_slot(chunk_index, bg->max_chunks)];
 
-    // Find empty slot or oldest chunk
-    int slot = -1;
-    for (int i = 0; i < MAX_CACHED_CHUNKS; i++)
+    if (chunk->generated && chunk->chunk_index == chunk_index)
     {
-        if (!bg->chunks[i].generated)
-        {
-            slot = i;
-            break;
-        }
+        bg->stats.chunk_hits++;
+        return chunk;
     }
 
-    if (slot == -1)
-    {
-        slot = 0; // Reuse first slot if all full
-    }
-
-    // Generate new chunk
-    generate_mountain_chunk(&bg->chunks[slot], chunk_index, bg->mountain_base_height, bg->seed_variant);
-    return &bg->chunks[slot];
+    bg->stats.chunk_misses++;
+    generate_mountain_chunk(chunk, chunk_index, bg->mountain_base_height, bg->seed_variant);
+    return chunk;
 }
 
 // Generate a cloud at a specific world position
@@ -107,37 +129,20 @@ static void generate_cloud(Cloud *cloud, int cloud_id)
     cloud->generated = true;
 }
 
-// Get or create a cloud for a given id
+// Get or create a cloud for a given id (direct-mapped like the chunk cache)
 static Cloud *get_cloud(Background *bg, int cloud_id)
 {
-    // Look for existing cloud
-    for (int i = 0; i < MAX_CACHED_CLOUDS; i++)
-    {
-        if (bg->clouds[i].generated && bg->clouds[i].cloud_id == cloud_id)
-        {
-            return &bg->clouds[i];
-        }
-    }
+    Cloud *cloud = &bg->clouds[cache_slot(cloud_id, bg->max_clouds)];
 
-    // Find empty slot
-    int slot = -1;
-    for (int i = 0; i < MAX_CACHED_CLOUDS; i++)
+    if (cloud->generated && cloud->cloud_id == cloud_id)
     {
-        if (!bg->clouds[i].generated)
-        {
-            slot = i;
-            break;
-        }
+        bg->stats.cloud_hits++;
+        return cloud;
     }
 
-    if (slot == -1)
-    {
-        slot = 0; // Reuse first slot if all full
-    }
-
-    // Generate new cloud
-    generate_cloud(&bg->clouds[slot], cloud_id);
-    return &bg->clouds[slot];
+    bg->stats.cloud_misses++;
+    generate_cloud(cloud, cloud_id);
+    return cloud;
 }
 
 Background background_create(void)
@@ -151,21 +156,30 @@ Background background_create_with_variant(int seed_variant)
     bg.chunk_size = CHUNK_WIDTH;
     bg.mountain_base_height = MOUNTAIN_BASE_HEIGHT;
     bg.seed_variant = seed_variant;
-    bg.max_chunks = MAX_CACHED_CHUNKS;
-    bg.max_clouds = MAX_CACHED_CLOUDS;
-    bg.chunks = (BackgroundChunk *)malloc(MAX_CACHED_CHUNKS * sizeof(BackgroundChunk));
-    bg.clouds = (Cloud *)malloc(MAX_CACHED_CLOUDS * sizeof(Cloud));
+
+    // Size the caches from the screen width: the visible range plus look-ahead on either side
+    int screen_width = GetScreenWidth() > 0 ? GetScreenWidth() : FALLBACK_SCREEN_WIDTH;
+    bg.chunk_radius = (screen_width / 2) / CHUNK_WIDTH + 2;
+    bg.cloud_radius = (screen_width / 2) / CLOUD_SPACING + 1;
+    bg.max_chunks = bg.chunk_radius * 2 + 1 + LOOKAHEAD_CHUNKS * 2;
+    bg.max_clouds = bg.cloud_radius * 2 + 1 + LOOKAHEAD_CLOUDS * 2;
+    bg.chunks = (BackgroundChunk *)malloc(bg.max_chunks * sizeof(BackgroundChunk));
+    bg.clouds = (Cloud *)malloc(bg.max_clouds * sizeof(Cloud));
+    bg.stats = (BackgroundCacheStats){0};
 
     // Initialize chunks
-    for (int i = 0; i < MAX_CACHED_CHUNKS; i++)
+    for (int i = 0; i < bg.max_chunks; i++)
     {
         bg.chunks[i].generated = false;
         bg.chunks[i].mountain_points = NULL;
         bg.chunks[i].mountain_point_count = 0;
+        bg.chunks[i].fill_strip = NULL;
+        bg.chunks[i].fill_strip_count = 0;
+        bg.chunks[i].outline_strip = NULL;
     }
 
     // Initialize clouds
-    for (int i = 0; i < MAX_CACHED_CLOUDS; i++)
+    for (int i = 0; i < bg.max_clouds; i++)
     {
         bg.clouds[i].generated = false;
     }
@@ -179,13 +193,40 @@ Background background_create_with_variant(int seed_variant)
     return bg;
 }
 
-void background_update(Background *bg, Vector2 player_pos)
+void background_update(Background *bg, Vector2 player_pos, Vector2 player_velocity)
 {
     // Update camera to follow player
     bg->camera.target = (Vector2){
         player_pos.x,
         150 // Fixed vertical position
     };
+
+    // Make sure everything on screen is cached, then generate ahead in the
+    // direction of travel so drawing never has to generate mid-frame
+    int center_chunk = (int)floorf(bg->camera.target.x / CHUNK_WIDTH);
+    int center_cloud = (int)floorf(bg->camera.target.x / CLOUD_SPACING);
+    int direction = (player_velocity.x > 0.0f) - (player_velocity.x < 0.0f);
+
+    for (int i = -bg->chunk_radius; i <= bg->chunk_radius; i++)
+    {
+        get_chunk(bg, center_chunk + i);
+    }
+    for (int i = -bg->cloud_radius; i <= bg->cloud_radius; i++)
+    {
+        get_cloud(bg, center_cloud + i);
+    }
+
+    if (direction != 0)
+    {
+        for (int i = 1; i <= LOOKAHEAD_CHUNKS; i++)
+        {
+            get_chunk(bg, center_chunk + direction * (bg->chunk_radius + i));
+        }
+        for (int i = 1; i <= LOOKAHEAD_CLOUDS; i++)
+        {
+            get_cloud(bg, center_cloud + direction * (bg->cloud_radius + i));
+        }
+    }
 }
 
 void background_draw(Background *bg)
@@ -194,10 +235,18 @@ void background_draw(Background *bg)
     DrawRectangle(0, 0, GetScreenWidth(), GROUND_Y, (Color){135, 206, 235, 255});
 
     // Determine which chunks are visible
-    int center_chunk = (int)(bg->camera.target.x / CHUNK_WIDTH);
+    int center_chunk = (int)floorf(bg->camera.target.x / CHUNK_WIDTH);
+
+    // Mountain strips are stored in world space, so translate them with a camera
+    // instead of converting every point to screen space
+    Camera2D mountain_camera = {0};
+    mountain_camera.offset = (Vector2){GetScreenWidth() / 2, 0};
+    mountain_camera.target = (Vector2){bg->camera.target.x, 0};
+    mountain_camera.zoom = 1.0f;
 
     // Draw mountains for visible chunks (draw before dirt so mountains sit on top of sky but under dirt)
-    for (int chunk_offset = -2; chunk_offset <= 2; chunk_offset++)
+    BeginMode2D(mountain_camera);
+    for (int chunk_offset = -bg->chunk_radius; chunk_offset <= bg->chunk_radius; chunk_offset++)
     {
         int chunk_idx = center_chunk + chunk_offset;
         BackgroundChunk *chunk = get_chunk(bg, chunk_idx);
@@ -205,73 +254,17 @@ void background_draw(Background *bg)
         if (chunk->mountain_point_count < 2)
             continue;
 
-        // Draw mountain as filled polygon
-        Vector2 *screen_points = (Vector2 *)malloc((chunk->mountain_point_count + 2) * sizeof(Vector2));
-
-        // Add base points for filled area
-        for (int i = 0; i < chunk->mountain_point_count; i++)
-        {
-            screen_points[i] = (Vector2){
-                chunk->mountain_points[i].x - bg->camera.target.x + GetScreenWidth() / 2,
-                chunk->mountain_points[i].y};
-        }
-
-        // Close the polygon with ground level
-        screen_points[chunk->mountain_point_count] = (Vector2){
-            chunk->mountain_points[chunk->mountain_point_count - 1].x - bg->camera.target.x + GetScreenWidth() / 2,
-            GetScreenHeight()};
-        screen_points[chunk->mountain_point_count + 1] = (Vector2){
-            chunk->mountain_points[0].x - bg->camera.target.x + GetScreenWidth() / 2,
-            GetScreenHeight()};
-
-        // Fill mountain with vertical lines from outline to ground
-        // For each mountain segment, draw vertical fill lines
-        for (int i = 0; i < chunk->mountain_point_count - 1; i++)
-        {
-            Vector2 p1 = screen_points[i];
-            Vector2 p2 = screen_points[i + 1];
-
-            // Get integer bounds
-            int x_start = (int)p1.x;
-            int x_end = (int)p2.x;
-
-            // Ensure proper order
-            if (x_start > x_end)
-            {
-                int temp = x_start;
-                x_start = x_end;
-                x_end = temp;
-            }
-
-            // Draw vertical lines for each X position
-            for (int x = x_start; x <= x_end; x++)
-            {
-                // Interpolate Y position along the mountain line
-                float t = (x_end > x_start) ? (float)(x - x_start) / (x_end - x_start) : 0;
-                float y_peak = p1.y + t * (p2.y - p1.y);
-
-                // Draw vertical line from peak to ground
-                DrawLine(x, (int)y_peak, x, GROUND_Y, (Color){230, 200, 130, 255});
-            }
-        }
-
-        // Draw mountain outline
-        for (int i = 0; i < chunk->mountain_point_count; i++)
-        {
-            Vector2 p1 = screen_points[i];
-            Vector2 p2 = screen_points[i + 1];
-            DrawLine((int)p1.x, (int)p1.y, (int)p2.x, (int)p2.y, (Color){200, 170, 100, 255});
-        }
-
-        free(screen_points);
+        DrawTriangleStrip(chunk->fill_strip, chunk->fill_strip_count, (Color){230, 200, 130, 255});
+        DrawLineStrip(chunk->outline_strip, chunk->mountain_point_count, (Color){200, 170, 100, 255});
     }
+    EndMode2D();
 
     // Draw dirt/ground below ground level (draw after mountains so dirt is on top of mountains)
     DrawRectangle(0, GROUND_Y, GetScreenWidth(), GetScreenHeight() - GROUND_Y, (Color){139, 90, 43, 255});
 
     // Draw clouds - generate visible clouds based on camera position
-    int center_cloud = (int)(bg->camera.target.x / CLOUD_SPACING);
-    for (int cloud_offset = -2; cloud_offset <= 3; cloud_offset++)
+    int center_cloud = (int)floorf(bg->camera.target.x / CLOUD_SPACING);
+    for (int cloud_offset = -bg->cloud_radius; cloud_offset <= bg->cloud_radius; cloud_offset++)
     {
         int cloud_id = center_cloud + cloud_offset;
         Cloud *cloud = get_cloud(bg, cloud_id);
@@ -353,12 +346,20 @@ void background_draw_with_hazards(Background *bg, const void *hazard_list)
 
 void background_cleanup(Background *bg)
 {
-    for (int i = 0; i < MAX_CACHED_CHUNKS; i++)
+    for (int i = 0; i < bg->max_chunks; i++)
     {
         if (bg->chunks[i].mountain_points)
         {
             free(bg->chunks[i].mountain_points);
         }
+        if (bg->chunks[i].fill_strip)
+        {
+            free(bg->chunks[i].fill_strip);
+        }
+        if (bg->chunks[i].outline_strip)
+        {
+            free(bg->chunks[i].outline_strip);
+        }
     }
     free(bg->chunks);
     free(bg->clouds);
@@ -0,0 +1,456 @@
+#include "game.h"
+#include "asset_paths.h"
+#include "config.h"
+#include "texture_cache.h"
+#include "replay.h"
+#include "input_script.h"
+#include "sim_clock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Level benchmark: drives every level headless for a fixed number of ticks and reports
+// nanoseconds per tick (mean, p50, p99) in total and for each section of game_step.
+//
+// Usage: bench_levels [--ticks N] [--seed N] [--script idle|walk|hop] [--level N]
+//                     [--replay FILE] [--out FILE] [--baseline FILE] [--threshold PCT]
+//                     [--threads N]
+//
+// Results are written as JSON (to stdout unless --out is given), along with how many sectors
+// were awake and how many entities the sleeping sectors skipped per tick. With --baseline, mean
+// times are compared against an earlier result file; anything slower by more than the
+// threshold (default 10%) is listed under "regressions" and the exit code is 1.
+//
+// Whenever the run leaves the level (death, goal reached) the level is restarted, so every
+// measured tick is a tick of live simulation. --replay benchmarks the recording's start
+// level only, until the recording ends or moves on to another level.
+//
+// Collision candidates are tested on the game thread alone unless --threads asks for more,
+// so results stay comparable with earlier runs; the count is written to the results.
+
+#define DEFAULT_TICKS (SIMULATION_TICK_RATE * 30) // Thirty seconds of game time per level
+#define DEFAULT_THRESHOLD_PERCENT 10.0
+
+// Differences below this are timer noise, whatever the percentage says
+#define REGRESSION_NOISE_FLOOR_NS 50.0
+
+#define SAMPLE_TOTAL STEP_PHASE_COUNT // Sample column holding the whole tick
+#define SAMPLE_COLUMNS (STEP_PHASE_COUNT + 1)
+
+static const char *phase_names[STEP_PHASE_COUNT] = {
+    "hazards", "player", "monsters", "projectiles", "pickups", "loot", "collisions", "rules"};
+
+typedef struct
+{
+    double mean_ns;
+    unsigned long long p50_ns;
+    unsigned long long p99_ns;
+} TickStats;
+
+typedef struct
+{
+    int level;  // 1-based
+    long ticks; // Ticks measured
+    TickStats total;
+    TickStats phases[STEP_PHASE_COUNT];
+    double mean_active_sectors;
+    double mean_skipped; // Entities the sector window skipped per tick
+} LevelResult;
+
+static void print_usage(void)
+{
+    printf("Usage: bench_levels [--ticks N] [--seed N] [--script idle|walk|hop] [--level N]\n");
+    printf("                    [--replay FILE] [--out FILE] [--baseline FILE] [--threshold PCT]\n");
+    printf("                    [--threads N]\n");
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    unsigned long long x = *(const unsigned long long *)a;
+    unsigned long long y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of an already sorted array
+static unsigned long long percentile(const unsigned long long *sorted, long count, double fraction)
+{
+    long rank = (long)(fraction * (double)count + 0.999999);
+    if (rank < 1)
+        rank = 1;
+    if (rank > count)
+        rank = count;
+    return sorted[rank - 1];
+}
+
+// Summarize one sample column. Sorts the column in place.
+static TickStats compute_stats(unsigned long long *samples, long count)
+{
+    TickStats stats = {0};
+    if (count == 0)
+        return stats;
+
+    double sum = 0.0;
+    for (long i = 0; i < count; i++)
+    {
+        sum += (double)samples[i];
+    }
+    qsort(samples, (size_t)count, sizeof(unsigned long long), compare_u64);
+
+    stats.mean_ns = sum / (double)count;
+    stats.p50_ns = percentile(samples, count, 0.50);
+    stats.p99_ns = percentile(samples, count, 0.99);
+    return stats;
+}
+
+// Run one level and fill in its result. samples holds SAMPLE_COLUMNS arrays of max_ticks.
+static void bench_level(GameState *state, int level_index, long max_ticks, InputScript script,
+                        ReplayPlayer *replayer, unsigned long long *samples, LevelResult *result)
+{
+    StepTimings timings;
+    state->step_timings = &timings;
+    state->in_level_transition = false;
+    game_sim_start_level(state, level_index);
+
+    long tick = 0;
+    long script_tick = 0;
+    double active_sectors = 0.0;
+    double skipped = 0.0;
+    for (; tick < max_ticks; tick++, script_tick++)
+    {
+        if (!game_sim_is_active(state) || state->game_victory)
+        {
+            if (replayer)
+                break; // The recording left its start level
+            state->in_level_transition = false;
+            game_sim_start_level(state, level_index);
+            script_tick = 0;
+        }
+
+        PlayerInput input;
+        if (replayer)
+        {
+            ReplayTick recorded;
+            if (!replay_player_next(replayer, &recorded))
+                break;
+            state->pause_menu_active = recorded.pause_menu_active;
+            input = recorded.input;
+        }
+        else
+        {
+            input = input_script_next(script, script_tick, state);
+        }
+
+        memset(&timings, 0, sizeof(timings));
+        unsigned long long start = sim_clock_ns();
+        game_step(state, &input, SIMULATION_DT);
+        unsigned long long elapsed = sim_clock_ns() - start;
+        active_sectors += state->sector_stats.active_sectors;
+        skipped += sector_stats_skipped(&state->sector_stats);
+
+        samples[SAMPLE_TOTAL * max_ticks + tick] = elapsed;
+        for (int phase = 0; phase < STEP_PHASE_COUNT; phase++)
+        {
+            samples[phase * max_ticks + tick] = timings.ns[phase];
+        }
+    }
+    state->step_timings = NULL;
+    state->pause_menu_active = false;
+
+    result->level = level_index + 1;
+    result->ticks = tick;
+    result->total = compute_stats(&samples[SAMPLE_TOTAL * max_ticks], tick);
+    result->mean_active_sectors = tick > 0 ? active_sectors / (double)tick : 0.0;
+    result->mean_skipped = tick > 0 ? skipped / (double)tick : 0.0;
+    for (int phase = 0; phase < STEP_PHASE_COUNT; phase++)
+    {
+        result->phases[phase] = compute_stats(&samples[phase * max_ticks], tick);
+    }
+}
+
+// ============ BASELINE COMPARISON ============
+
+static char *read_text_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *text = (char *)malloc((size_t)size + 1);
+    if (text)
+    {
+        size_t read = fread(text, 1, (size_t)size, file);
+        text[read] = '\0';
+    }
+    fclose(file);
+    return text;
+}
+
+// Find "mean_ns" of a named entry ("total" or a phase) inside one level of a result file.
+// Only understands the layout write_results produces.
+static bool baseline_mean(const char *text, int level, const char *name, double *mean_ns)
+{
+    char level_key[32];
+    snprintf(level_key, sizeof(level_key), "\"level\": %d,", level);
+    const char *level_start = strstr(text, level_key);
+    if (!level_start)
+        return false;
+    const char *level_end = strstr(level_start + 1, "\"level\": ");
+
+    char name_key[64];
+    snprintf(name_key, sizeof(name_key), "\"%s\": {\"mean_ns\": ", name);
+    const char *entry = strstr(level_start, name_key);
+    if (!entry || (level_end && entry > level_end))
+        return false;
+
+    *mean_ns = strtod(entry + strlen(name_key), NULL);
+    return true;
+}
+
+typedef struct
+{
+    int level;
+    const char *name;
+    double baseline_ns;
+    double current_ns;
+} Regression;
+
+static bool is_regression(double baseline_ns, double current_ns, double threshold_percent)
+{
+    return current_ns - baseline_ns > REGRESSION_NOISE_FLOOR_NS &&
+           current_ns > baseline_ns * (1.0 + threshold_percent / 100.0);
+}
+
+// Returns the number of regressions written to out (at most max_out)
+static int compare_with_baseline(const char *text, const LevelResult *results, int result_count,
+                                 double threshold_percent, Regression *out, int max_out)
+{
+    int count = 0;
+    for (int i = 0; i < result_count && count < max_out; i++)
+    {
+        const LevelResult *result = &results[i];
+        double baseline_ns;
+        if (baseline_mean(text, result->level, "total", &baseline_ns) &&
+            is_regression(baseline_ns, result->total.mean_ns, threshold_percent))
+        {
+            out[count++] = (Regression){result->level, "total", baseline_ns, result->total.mean_ns};
+        }
+        for (int phase = 0; phase < STEP_PHASE_COUNT && count < max_out; phase++)
+        {
+            if (baseline_mean(text, result->level, phase_names[phase], &baseline_ns) &&
+                is_regression(baseline_ns, result->phases[phase].mean_ns, threshold_percent))
+            {
+                out[count++] = (Regression){result->level, phase_names[phase], baseline_ns, result->phases[phase].mean_ns};
+            }
+        }
+    }
+    return count;
+}
+
+// ============ OUTPUT ============
+
+static void write_stats(FILE *file, const char *name, const TickStats *stats)
+{
+    fprintf(file, "\"%s\": {\"mean_ns\": %.1f, \"p50_ns\": %llu, \"p99_ns\": %llu}",
+            name, stats->mean_ns, stats->p50_ns, stats->p99_ns);
+}
+
+static void write_results(FILE *file, long ticks, unsigned int seed, const char *input_name, int contact_threads,
+                          const LevelResult *results, int result_count,
+                          const Regression *regressions, int regression_count, double threshold_percent)
+{
+    fprintf(file, "{\n");
+    fprintf(file, "  \"ticks_per_level\": %ld,\n", ticks);
+    fprintf(file, "  \"tick_rate\": %d,\n", SIMULATION_TICK_RATE);
+    fprintf(file, "  \"seed\": %u,\n", seed);
+    fprintf(file, "  \"input\": \"%s\",\n", input_name);
+    fprintf(file, "  \"contact_threads\": %d,\n", contact_threads);
+    fprintf(file, "  \"levels\": [\n");
+    for (int i = 0; i < result_count; i++)
+    {
+        const LevelResult *result = &results[i];
+        fprintf(file, "    {\"level\": %d, \"ticks\": %ld,\n      ", result->level, result->ticks);
+        write_stats(file, "total", &result->total);
+        fprintf(file, ",\n      \"phases\": {\n");
+        for (int phase = 0; phase < STEP_PHASE_COUNT; phase++)
+        {
+            fprintf(file, "        ");
+            write_stats(file, phase_names[phase], &result->phases[phase]);
+            fprintf(file, phase + 1 < STEP_PHASE_COUNT ? ",\n" : "\n");
+        }
+        fprintf(file, "      },\n      \"sectors\": {\"mean_active\": %.2f, \"mean_skipped\": %.2f}}%s\n",
+                result->mean_active_sectors, result->mean_skipped, i + 1 < result_count ? "," : "");
+    }
+    fprintf(file, "  ]");
+
+    if (threshold_percent >= 0.0)
+    {
+        fprintf(file, ",\n  \"threshold_percent\": %.1f,\n  \"regressions\": [", threshold_percent);
+        for (int i = 0; i < regression_count; i++)
+        {
+            const Regression *r = &regressions[i];
+            fprintf(file, "%s\n    {\"level\": %d, \"section\": \"%s\", \"baseline_mean_ns\": %.1f, \"mean_ns\": %.1f, \"change_percent\": %.1f}",
+                    i > 0 ? "," : "", r->level, r->name, r->baseline_ns, r->current_ns,
+                    (r->current_ns / r->baseline_ns - 1.0) * 100.0);
+        }
+        fprintf(file, "%s]", regression_count > 0 ? "\n  " : "");
+    }
+    fprintf(file, "\n}\n");
+}
+
+int main(int argc, char *argv[])
+{
+    long ticks = DEFAULT_TICKS;
+    unsigned int seed = 1;
+    int only_level = 0; // 0 = all levels
+    InputScript script = SCRIPT_HOP;
+    const char *replay_path = NULL;
+    const char *out_path = NULL;
+    const char *baseline_path = NULL;
+    double threshold_percent = DEFAULT_THRESHOLD_PERCENT;
+    int contact_threads = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--ticks") == 0 && has_value)
+            ticks = atol(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--level") == 0 && has_value)
+            only_level = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--replay") == 0 && has_value)
+            replay_path = argv[++i];
+        else if (strcmp(argv[i], "--out") == 0 && has_value)
+            out_path = argv[++i];
+        else if (strcmp(argv[i], "--baseline") == 0 && has_value)
+            baseline_path = argv[++i];
+        else if (strcmp(argv[i], "--threshold") == 0 && has_value)
+            threshold_percent = atof(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && has_value)
+            contact_threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--script") == 0 && has_value)
+        {
+            if (!input_script_parse(argv[++i], &script))
+            {
+                print_usage();
+                return 1;
+            }
+        }
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+    if (ticks <= 0)
+    {
+        print_usage();
+        return 1;
+    }
+
+    char *baseline_text = NULL;
+    if (baseline_path)
+    {
+        baseline_text = read_text_file(baseline_path);
+        if (!baseline_text)
+        {
+            fprintf(stderr, "bench_levels: could not read baseline '%s'\n", baseline_path);
+            return 1;
+        }
+    }
+
+    ReplayPlayer replayer = {0};
+    if (replay_path)
+    {
+        if (!replay_player_open(&replayer, replay_path))
+        {
+            free(baseline_text);
+            return 1;
+        }
+        only_level = replayer.start_level + 1;
+        seed = replayer.seed;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetRandomSeed(seed);
+    init_asset_paths();
+    texture_cache_set_headless(true);
+
+    GameState state = {0};
+    game_sim_init(&state, contact_threads);
+    if (only_level < 0 || only_level > state.level_count)
+    {
+        fprintf(stderr, "bench_levels: level must be between 1 and %d\n", state.level_count);
+        game_sim_cleanup(&state);
+        texture_cache_shutdown();
+        replay_player_close(&replayer);
+        free(baseline_text);
+        return 1;
+    }
+
+    int first = only_level ? only_level - 1 : 0;
+    int last = only_level ? only_level - 1 : state.level_count - 1;
+    int result_count = last - first + 1;
+
+    unsigned long long *samples = (unsigned long long *)malloc(sizeof(unsigned long long) * SAMPLE_COLUMNS * (size_t)ticks);
+    LevelResult *results = (LevelResult *)calloc((size_t)result_count, sizeof(LevelResult));
+    if (!samples || !results)
+    {
+        fprintf(stderr, "bench_levels: out of memory for %ld ticks\n", ticks);
+        free(samples);
+        free(results);
+        game_sim_cleanup(&state);
+        texture_cache_shutdown();
+        replay_player_close(&replayer);
+        free(baseline_text);
+        return 1;
+    }
+
+    for (int level_index = first; level_index <= last; level_index++)
+    {
+        LevelResult *result = &results[level_index - first];
+        bench_level(&state, level_index, ticks, script, replay_path ? &replayer : NULL, samples, result);
+        fprintf(stderr, "level %2d: %ld ticks, mean %.0f ns, p99 %llu ns\n",
+                result->level, result->ticks, result->total.mean_ns, result->total.p99_ns);
+    }
+
+    Regression regressions[SAMPLE_COLUMNS * MAX_LEVELS];
+    int regression_count = 0;
+    if (baseline_text)
+    {
+        regression_count = compare_with_baseline(baseline_text, results, result_count, threshold_percent,
+                                                 regressions, SAMPLE_COLUMNS * MAX_LEVELS);
+        for (int i = 0; i < regression_count; i++)
+        {
+            fprintf(stderr, "REGRESSION level %d %s: %.0f ns -> %.0f ns\n", regressions[i].level,
+                    regressions[i].name, regressions[i].baseline_ns, regressions[i].current_ns);
+        }
+    }
+
+    FILE *out = stdout;
+    if (out_path)
+    {
+        out = fopen(out_path, "w");
+        if (!out)
+        {
+            fprintf(stderr, "bench_levels: could not open '%s' for writing\n", out_path);
+            out = stdout;
+        }
+    }
+    write_results(out, ticks, seed, replay_path ? "replay" : input_script_name(script), contact_threads,
+                  results, result_count, regressions, regression_count,
+                  baseline_text ? threshold_percent : -1.0);
+    if (out != stdout)
+        fclose(out);
+
+    free(samples);
+    free(results);
+    free(baseline_text);
+    replay_player_close(&replayer);
+    game_sim_cleanup(&state);
+    texture_cache_shutdown();
+    return regression_count > 0 ? 1 : 0;
+}
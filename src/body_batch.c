@@ -0,0 +1,250 @@
+#include "body_batch.h"
+#include "config.h"
+#include <stdlib.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BODY_BATCH_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BODY_BATCH_SSE2
+#endif
+
+// Bodies further than this outside the view (horizontally) expire
+#define DESPAWN_MARGIN 1000.0f
+
+static void reserve(BodyBatch *batch, int capacity)
+{
+    if (capacity <= batch->capacity)
+        return;
+
+    if (capacity < batch->capacity * 2)
+        capacity = batch->capacity * 2;
+    batch->x = (float *)realloc(batch->x, sizeof(float) * capacity);
+    batch->y = (float *)realloc(batch->y, sizeof(float) * capacity);
+    batch->velocity_x = (float *)realloc(batch->velocity_x, sizeof(float) * capacity);
+    batch->velocity_y = (float *)realloc(batch->velocity_y, sizeof(float) * capacity);
+    batch->rotation = (float *)realloc(batch->rotation, sizeof(float) * capacity);
+    batch->lifetime = (float *)realloc(batch->lifetime, sizeof(float) * capacity);
+    batch->grounded = (int *)realloc(batch->grounded, sizeof(int) * capacity);
+    batch->source = (int *)realloc(batch->source, sizeof(int) * capacity);
+    batch->expired = (int *)realloc(batch->expired, sizeof(int) * capacity);
+    batch->capacity = capacity;
+}
+
+BodyBatch body_batch_create(int capacity)
+{
+    BodyBatch batch = {0};
+    reserve(&batch, capacity);
+    return batch;
+}
+
+void body_batch_cleanup(BodyBatch *batch)
+{
+    free(batch->x);
+    free(batch->y);
+    free(batch->velocity_x);
+    free(batch->velocity_y);
+    free(batch->rotation);
+    free(batch->lifetime);
+    free(batch->grounded);
+    free(batch->source);
+    free(batch->expired);
+    *batch = (BodyBatch){0};
+}
+
+void body_batch_begin(BodyBatch *batch, int count)
+{
+    reserve(batch, count);
+    batch->count = 0;
+    batch->expired_count = 0;
+}
+
+int body_batch_add(BodyBatch *batch, int source, Vector2 position, Vector2 velocity,
+                   float rotation, float lifetime, bool grounded)
+{
+    int slot = batch->count++;
+    batch->x[slot] = position.x;
+    batch->y[slot] = position.y;
+    batch->velocity_x[slot] = velocity.x;
+    batch->velocity_y[slot] = velocity.y;
+    batch->rotation[slot] = rotation;
+    batch->lifetime[slot] = lifetime;
+    batch->grounded[slot] = grounded ? 1 : 0;
+    batch->source[slot] = source;
+    return slot;
+}
+
+// ============ KERNELS ============
+// Each kernel handles bodies [start, end) and returns where it stopped. The vector kernels
+// stop before a partial group; the scalar kernel finishes whatever is left.
+
+static void add_expired(BodyBatch *batch, int first, unsigned int mask)
+{
+    for (int lane = 0; mask != 0; lane++, mask >>= 1)
+    {
+        if (mask & 1)
+            batch->expired[batch->expired_count++] = batch->source[first + lane];
+    }
+}
+
+static int integrate_scalar(BodyBatch *batch, const BodyKind *kind, float min_x, float max_x, float delta_time, int start, int end)
+{
+    float fall = kind->gravity * delta_time;
+    float turn = kind->spin * delta_time;
+
+    for (int i = start; i < end; i++)
+    {
+        if (!batch->grounded[i])
+        {
+            batch->velocity_y[i] += fall;
+            if (batch->y[i] >= kind->ground_y)
+            {
+                batch->y[i] = kind->ground_y;
+                batch->velocity_y[i] = 0.0f;
+                batch->grounded[i] = 1;
+            }
+        }
+
+        batch->x[i] += batch->velocity_x[i] * delta_time;
+        batch->y[i] += batch->velocity_y[i] * delta_time;
+        batch->rotation[i] += turn;
+        batch->lifetime[i] -= delta_time;
+
+        if (batch->lifetime[i] <= 0.0f || batch->x[i] < min_x || batch->x[i] > max_x || batch->y[i] > kind->despawn_y)
+        {
+            batch->expired[batch->expired_count++] = batch->source[i];
+        }
+    }
+    return end;
+}
+
+#ifdef BODY_BATCH_SSE2
+static __m128 select_ps(__m128 mask, __m128 if_set, __m128 if_clear)
+{
+    return _mm_or_ps(_mm_and_ps(mask, if_set), _mm_andnot_ps(mask, if_clear));
+}
+
+static int integrate_sse2(BodyBatch *batch, const BodyKind *kind, float min_x, float max_x, float delta_time, int start, int end)
+{
+    const __m128 dt = _mm_set1_ps(delta_time);
+    const __m128 fall = _mm_set1_ps(kind->gravity * delta_time);
+    const __m128 turn = _mm_set1_ps(kind->spin * delta_time);
+    const __m128 ground_y = _mm_set1_ps(kind->ground_y);
+    const __m128 despawn_y = _mm_set1_ps(kind->despawn_y);
+    const __m128 min_x4 = _mm_set1_ps(min_x);
+    const __m128 max_x4 = _mm_set1_ps(max_x);
+    const __m128 zero = _mm_setzero_ps();
+
+    int i = start;
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(&batch->x[i]);
+        __m128 y = _mm_loadu_ps(&batch->y[i]);
+        __m128 vx = _mm_loadu_ps(&batch->velocity_x[i]);
+        __m128 vy = _mm_loadu_ps(&batch->velocity_y[i]);
+        __m128i grounded = _mm_loadu_si128((const __m128i *)&batch->grounded[i]);
+
+        __m128 falling = _mm_castsi128_ps(_mm_cmpeq_epi32(grounded, _mm_setzero_si128()));
+        vy = select_ps(falling, _mm_add_ps(vy, fall), vy);
+        __m128 lands = _mm_and_ps(falling, _mm_cmpge_ps(y, ground_y));
+        y = select_ps(lands, ground_y, y);
+        vy = select_ps(lands, zero, vy);
+        grounded = _mm_sub_epi32(grounded, _mm_castps_si128(lands)); // A set mask is -1
+
+        x = _mm_add_ps(x, _mm_mul_ps(vx, dt));
+        y = _mm_add_ps(y, _mm_mul_ps(vy, dt));
+        __m128 rotation = _mm_add_ps(_mm_loadu_ps(&batch->rotation[i]), turn);
+        __m128 lifetime = _mm_sub_ps(_mm_loadu_ps(&batch->lifetime[i]), dt);
+
+        _mm_storeu_ps(&batch->x[i], x);
+        _mm_storeu_ps(&batch->y[i], y);
+        _mm_storeu_ps(&batch->velocity_y[i], vy);
+        _mm_storeu_ps(&batch->rotation[i], rotation);
+        _mm_storeu_ps(&batch->lifetime[i], lifetime);
+        _mm_storeu_si128((__m128i *)&batch->grounded[i], grounded);
+
+        __m128 expired = _mm_or_ps(_mm_or_ps(_mm_cmple_ps(lifetime, zero), _mm_cmplt_ps(x, min_x4)),
+                                   _mm_or_ps(_mm_cmpgt_ps(x, max_x4), _mm_cmpgt_ps(y, despawn_y)));
+        unsigned int mask = (unsigned int)_mm_movemask_ps(expired);
+        if (mask)
+            add_expired(batch, i, mask);
+    }
+    return i;
+}
+#endif
+
+#ifdef BODY_BATCH_AVX2
+static __m256 select_ps256(__m256 mask, __m256 if_set, __m256 if_clear)
+{
+    return _mm256_blendv_ps(if_clear, if_set, mask);
+}
+
+static int integrate_avx2(BodyBatch *batch, const BodyKind *kind, float min_x, float max_x, float delta_time, int start, int end)
+{
+    const __m256 dt = _mm256_set1_ps(delta_time);
+    const __m256 fall = _mm256_set1_ps(kind->gravity * delta_time);
+    const __m256 turn = _mm256_set1_ps(kind->spin * delta_time);
+    const __m256 ground_y = _mm256_set1_ps(kind->ground_y);
+    const __m256 despawn_y = _mm256_set1_ps(kind->despawn_y);
+    const __m256 min_x8 = _mm256_set1_ps(min_x);
+    const __m256 max_x8 = _mm256_set1_ps(max_x);
+    const __m256 zero = _mm256_setzero_ps();
+
+    int i = start;
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(&batch->x[i]);
+        __m256 y = _mm256_loadu_ps(&batch->y[i]);
+        __m256 vx = _mm256_loadu_ps(&batch->velocity_x[i]);
+        __m256 vy = _mm256_loadu_ps(&batch->velocity_y[i]);
+        __m256i grounded = _mm256_loadu_si256((const __m256i *)&batch->grounded[i]);
+
+        __m256 falling = _mm256_castsi256_ps(_mm256_cmpeq_epi32(grounded, _mm256_setzero_si256()));
+        vy = select_ps256(falling, _mm256_add_ps(vy, fall), vy);
+        __m256 lands = _mm256_and_ps(falling, _mm256_cmp_ps(y, ground_y, _CMP_GE_OQ));
+        y = select_ps256(lands, ground_y, y);
+        vy = select_ps256(lands, zero, vy);
+        grounded = _mm256_sub_epi32(grounded, _mm256_castps_si256(lands)); // A set mask is -1
+
+        x = _mm256_add_ps(x, _mm256_mul_ps(vx, dt));
+        y = _mm256_add_ps(y, _mm256_mul_ps(vy, dt));
+        __m256 rotation = _mm256_add_ps(_mm256_loadu_ps(&batch->rotation[i]), turn);
+        __m256 lifetime = _mm256_sub_ps(_mm256_loadu_ps(&batch->lifetime[i]), dt);
+
+        _mm256_storeu_ps(&batch->x[i], x);
+        _mm256_storeu_ps(&batch->y[i], y);
+        _mm256_storeu_ps(&batch->velocity_y[i], vy);
+        _mm256_storeu_ps(&batch->rotation[i], rotation);
+        _mm256_storeu_ps(&batch->lifetime[i], lifetime);
+        _mm256_storeu_si256((__m256i *)&batch->grounded[i], grounded);
+
+        __m256 expired = _mm256_or_ps(
+            _mm256_or_ps(_mm256_cmp_ps(lifetime, zero, _CMP_LE_OQ), _mm256_cmp_ps(x, min_x8, _CMP_LT_OQ)),
+            _mm256_or_ps(_mm256_cmp_ps(x, max_x8, _CMP_GT_OQ), _mm256_cmp_ps(y, despawn_y, _CMP_GT_OQ)));
+        unsigned int mask = (unsigned int)_mm256_movemask_ps(expired);
+        if (mask)
+            add_expired(batch, i, mask);
+    }
+    return i;
+}
+#endif
+
+void body_batch_integrate(BodyBatch *batch, const BodyKind *kind, float camera_x, float delta_time)
+{
+    batch->expired_count = 0;
+
+    // Computed once, so every path compares against the same bounds
+    float min_x = camera_x - VIEW_WIDTH / 2.0f - DESPAWN_MARGIN;
+    float max_x = camera_x + VIEW_WIDTH / 2.0f + DESPAWN_MARGIN;
+
+    int i = 0;
+#ifdef BODY_BATCH_AVX2
+    i = integrate_avx2(batch, kind, min_x, max_x, delta_time, i, batch->count);
+#endif
+#ifdef BODY_BATCH_SSE2
+    i = integrate_sse2(batch, kind, min_x, max_x, delta_time, i, batch->count);
+#endif
+    integrate_scalar(batch, kind, min_x, max_x, delta_time, i, batch->count);
+}
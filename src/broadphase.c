@@ -0,0 +1,210 @@
+#include "broadphase.h"
+#include <stdlib.h>
+
+Broadphase broadphase_create(int capacity)
+{
+    Broadphase broadphase = {0};
+    broadphase.proxy_capacity = capacity > 0 ? capacity : 16;
+    broadphase.proxies = (BroadphaseProxy *)malloc(sizeof(BroadphaseProxy) * broadphase.proxy_capacity);
+    broadphase.order = (int *)malloc(sizeof(int) * broadphase.proxy_capacity);
+    broadphase.pair_capacity = broadphase.proxy_capacity;
+    broadphase.pairs = (BroadphasePair *)malloc(sizeof(BroadphasePair) * broadphase.pair_capacity);
+    return broadphase;
+}
+
+void broadphase_cleanup(Broadphase *broadphase)
+{
+    free(broadphase->proxies);
+    free(broadphase->order);
+    free(broadphase->pairs);
+    free(broadphase->hits);
+    for (int kind = 0; kind < BROADPHASE_KIND_COUNT; kind++)
+    {
+        free(broadphase->kinds[kind].proxy_ids);
+    }
+    *broadphase = (Broadphase){0};
+}
+
+void broadphase_clear(Broadphase *broadphase)
+{
+    broadphase->proxy_count = 0;
+    broadphase->pair_count = 0;
+    for (int kind = 0; kind < BROADPHASE_KIND_COUNT; kind++)
+    {
+        broadphase->kinds[kind].count = 0;
+    }
+}
+
+// Proxy id for an entity, creating the proxy on first use
+static int proxy_for(Broadphase *broadphase, BroadphaseKind kind, int index)
+{
+    BroadphaseKindTable *table = &broadphase->kinds[kind];
+    if (index >= table->capacity)
+    {
+        int capacity = table->capacity > 0 ? table->capacity : 16;
+        while (capacity <= index)
+            capacity *= 2;
+        table->proxy_ids = (int *)realloc(table->proxy_ids, sizeof(int) * capacity);
+        table->capacity = capacity;
+    }
+    while (table->count <= index)
+    {
+        table->proxy_ids[table->count++] = -1;
+    }
+    if (table->proxy_ids[index] >= 0)
+        return table->proxy_ids[index];
+
+    if (broadphase->proxy_count >= broadphase->proxy_capacity)
+    {
+        broadphase->proxy_capacity *= 2;
+        broadphase->proxies = (BroadphaseProxy *)realloc(broadphase->proxies, sizeof(BroadphaseProxy) * broadphase->proxy_capacity);
+        broadphase->order = (int *)realloc(broadphase->order, sizeof(int) * broadphase->proxy_capacity);
+    }
+
+    // New proxies go on the end of the order; the next sort moves them into place
+    int id = broadphase->proxy_count++;
+    broadphase->proxies[id] = (BroadphaseProxy){0};
+    broadphase->proxies[id].kind = kind;
+    broadphase->proxies[id].index = index;
+    broadphase->order[id] = id;
+    table->proxy_ids[index] = id;
+    return id;
+}
+
+void broadphase_set(Broadphase *broadphase, BroadphaseKind kind, int index, Rectangle bounds,
+                    unsigned int layer, unsigned int mask)
+{
+    int id = proxy_for(broadphase, kind, index); // May grow the proxy array
+    BroadphaseProxy *proxy = &broadphase->proxies[id];
+    proxy->min_x = bounds.x;
+    proxy->max_x = bounds.x + bounds.width;
+    proxy->min_y = bounds.y;
+    proxy->max_y = bounds.y + bounds.height;
+    proxy->layer = layer;
+    proxy->mask = mask;
+    proxy->enabled = true;
+}
+
+void broadphase_disable(Broadphase *broadphase, BroadphaseKind kind, int index)
+{
+    BroadphaseKindTable *table = &broadphase->kinds[kind];
+    if (index < table->count && table->proxy_ids[index] >= 0)
+    {
+        broadphase->proxies[table->proxy_ids[index]].enabled = false;
+    }
+}
+
+void broadphase_truncate(Broadphase *broadphase, BroadphaseKind kind, int count)
+{
+    for (int index = count; index < broadphase->kinds[kind].count; index++)
+    {
+        broadphase_disable(broadphase, kind, index);
+    }
+}
+
+static bool sorts_before(const BroadphaseProxy *proxies, int a, int b)
+{
+    // Ties broken by id so the order (and the pair list) is deterministic
+    return proxies[a].min_x < proxies[b].min_x || (proxies[a].min_x == proxies[b].min_x && a < b);
+}
+
+static void add_pair(Broadphase *broadphase, int a, int b)
+{
+    if (broadphase->pair_count >= broadphase->pair_capacity)
+    {
+        broadphase->pair_capacity *= 2;
+        broadphase->pairs = (BroadphasePair *)realloc(broadphase->pairs, sizeof(BroadphasePair) * broadphase->pair_capacity);
+    }
+    broadphase->pairs[broadphase->pair_count++] = (BroadphasePair){a, b};
+}
+
+int broadphase_find_pairs(Broadphase *broadphase)
+{
+    const BroadphaseProxy *proxies = broadphase->proxies;
+    int *order = broadphase->order;
+    int count = broadphase->proxy_count;
+
+    // Insertion sort: linear when only a few proxies changed places since the last tick
+    for (int i = 1; i < count; i++)
+    {
+        int id = order[i];
+        int j = i - 1;
+        while (j >= 0 && sorts_before(proxies, id, order[j]))
+        {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = id;
+    }
+
+    // Sweep: each proxy only needs to look right until a left edge passes its right edge.
+    // Edges are inclusive so every pair CheckCollisionRecs would accept is reported.
+    broadphase->pair_count = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const BroadphaseProxy *a = &proxies[order[i]];
+        if (!a->enabled)
+            continue;
+
+        for (int j = i + 1; j < count && proxies[order[j]].min_x <= a->max_x; j++)
+        {
+            const BroadphaseProxy *b = &proxies[order[j]];
+            if (!b->enabled || ((a->mask & b->layer) == 0 && (b->mask & a->layer) == 0))
+                continue;
+            if (a->min_y <= b->max_y && b->min_y <= a->max_y)
+            {
+                add_pair(broadphase, order[i], order[j]);
+            }
+        }
+    }
+    return broadphase->pair_count;
+}
+
+static int compare_hits(const void *a, const void *b)
+{
+    const BroadphaseHit *x = (const BroadphaseHit *)a;
+    const BroadphaseHit *y = (const BroadphaseHit *)b;
+    if (x->first != y->first)
+        return x->first < y->first ? -1 : 1;
+    return (x->second > y->second) - (x->second < y->second);
+}
+
+static bool proxy_matches(const BroadphaseProxy *proxy, BroadphaseKind kind, unsigned int layers)
+{
+    return proxy->kind == kind && (proxy->layer & layers) != 0;
+}
+
+int broadphase_collect(Broadphase *broadphase, BroadphaseKind first_kind, unsigned int first_layers,
+                       BroadphaseKind second_kind, unsigned int second_layers, bool unique_first)
+{
+    if (broadphase->hit_capacity < broadphase->pair_count)
+    {
+        broadphase->hit_capacity = broadphase->pair_count;
+        broadphase->hits = (BroadphaseHit *)realloc(broadphase->hits, sizeof(BroadphaseHit) * broadphase->hit_capacity);
+    }
+
+    int count = 0;
+    for (int i = 0; i < broadphase->pair_count; i++)
+    {
+        const BroadphaseProxy *a = &broadphase->proxies[broadphase->pairs[i].a];
+        const BroadphaseProxy *b = &broadphase->proxies[broadphase->pairs[i].b];
+        if (proxy_matches(a, first_kind, first_layers) && proxy_matches(b, second_kind, second_layers))
+            broadphase->hits[count++] = (BroadphaseHit){a->index, b->index};
+        else if (proxy_matches(b, first_kind, first_layers) && proxy_matches(a, second_kind, second_layers))
+            broadphase->hits[count++] = (BroadphaseHit){b->index, a->index};
+    }
+    if (count > 1)
+        qsort(broadphase->hits, (size_t)count, sizeof(BroadphaseHit), compare_hits);
+
+    if (unique_first)
+    {
+        int unique = 0;
+        for (int i = 0; i < count; i++)
+        {
+            if (unique == 0 || broadphase->hits[unique - 1].first != broadphase->hits[i].first)
+                broadphase->hits[unique++] = broadphase->hits[i];
+        }
+        count = unique;
+    }
+    return count;
+}
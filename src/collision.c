@@ -0,0 +1,64 @@
+#include "collision.h"
+#include <math.h>
+
+// Open interval of times when [min_a, min_a + size_a] moving by d overlaps [min_b, min_b + size_b]
+static bool sweep_axis(float min_a, float size_a, float min_b, float size_b, float d, float *enter, float *exit)
+{
+    float max_a = min_a + size_a;
+    float max_b = min_b + size_b;
+
+    if (d == 0.0f)
+    {
+        // Not moving along this axis: it either overlaps the whole step or never
+        if (min_a < max_b && max_a > min_b)
+        {
+            *enter = -INFINITY;
+            *exit = INFINITY;
+            return true;
+        }
+        return false;
+    }
+
+    float t0 = (min_b - max_a) / d;
+    float t1 = (max_b - min_a) / d;
+    *enter = d > 0.0f ? t0 : t1;
+    *exit = d > 0.0f ? t1 : t0;
+    return true;
+}
+
+bool collision_sweep(Rectangle a_from, Rectangle a_to, Rectangle b_from, Rectangle b_to, float *time_of_impact)
+{
+    // Work in b's frame of reference: b stands still and a moves by the difference
+    float dx = (a_to.x - a_from.x) - (b_to.x - b_from.x);
+    float dy = (a_to.y - a_from.y) - (b_to.y - b_from.y);
+
+    float enter_x, exit_x, enter_y, exit_y;
+    if (sweep_axis(a_from.x, a_from.width, b_from.x, b_from.width, dx, &enter_x, &exit_x) &&
+        sweep_axis(a_from.y, a_from.height, b_from.y, b_from.height, dy, &enter_y, &exit_y))
+    {
+        float enter = fmaxf(enter_x, enter_y);
+        float exit = fminf(exit_x, exit_y);
+        if (enter < exit && enter < 1.0f && exit > 0.0f)
+        {
+            *time_of_impact = enter > 0.0f ? enter : 0.0f;
+            return true;
+        }
+    }
+
+    // Rounding in the differences above can disagree with the end positions right at an edge
+    if (CheckCollisionRecs(a_to, b_to))
+    {
+        *time_of_impact = 1.0f;
+        return true;
+    }
+    return false;
+}
+
+Rectangle collision_sweep_bounds(Rectangle from, Rectangle to)
+{
+    float min_x = fminf(from.x, to.x);
+    float min_y = fminf(from.y, to.y);
+    float max_x = fmaxf(from.x + from.width, to.x + to.width);
+    float max_y = fmaxf(from.y + from.height, to.y + to.height);
+    return (Rectangle){min_x, min_y, max_x - min_x, max_y - min_y};
+}
@@ -0,0 +1,344 @@
+#include "contacts.h"
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Windows builds have no pthreads; there every job runs on the calling thread
+#if !defined(_WIN32)
+#define CONTACT_WORKER_THREADS
+#include <pthread.h>
+#endif
+
+// One contact_pipeline_run: which jobs exist and how to test a candidate
+typedef struct
+{
+    ContactPipeline *pipeline;
+    ContactTest test;
+    void *context;
+    int job_start[CONTACT_CATEGORY_COUNT + 1]; // First job of each category
+    int thread_count;                          // Threads sharing the jobs this run
+} ContactRun;
+
+static void buffer_push(ContactBuffer *buffer, Contact contact)
+{
+    if (buffer->count >= buffer->capacity)
+    {
+        buffer->capacity = buffer->capacity > 0 ? buffer->capacity * 2 : 64;
+        buffer->contacts = (Contact *)realloc(buffer->contacts, sizeof(Contact) * buffer->capacity);
+    }
+    buffer->contacts[buffer->count++] = contact;
+}
+
+// Run every thread_count-th job starting at job thread, into that thread's buffer
+static void run_jobs(const ContactRun *run, int thread)
+{
+    ContactPipeline *pipeline = run->pipeline;
+    ContactBuffer *buffer = &pipeline->buffers[thread];
+    buffer->count = 0;
+
+    int category = 0;
+    for (int job = thread; job < run->job_start[CONTACT_CATEGORY_COUNT]; job += run->thread_count)
+    {
+        while (job >= run->job_start[category + 1])
+            category++;
+
+        const BroadphaseHit *candidates = pipeline->candidates[category];
+        int begin = (job - run->job_start[category]) * CONTACT_JOB_CANDIDATES;
+        int end = begin + CONTACT_JOB_CANDIDATES;
+        if (end > pipeline->candidate_count[category])
+            end = pipeline->candidate_count[category];
+
+        for (int i = begin; i < end; i++)
+        {
+            float time_of_impact = 0.0f;
+            if (run->test(run->context, (ContactCategory)category, candidates[i], &time_of_impact))
+                buffer_push(buffer, (Contact){(ContactCategory)category, candidates[i].first, candidates[i].second, time_of_impact});
+        }
+    }
+}
+
+// ============ WORKER THREADS ============
+
+#ifdef CONTACT_WORKER_THREADS
+typedef struct
+{
+    ContactWorkers *workers;
+    int thread; // 1 and up; the calling thread is 0
+} WorkerStart;
+
+struct ContactWorkers
+{
+    pthread_t *threads;
+    WorkerStart *starts;
+    int count;
+
+    pthread_mutex_t lock;
+    pthread_cond_t wake;     // A run started, or quitting
+    pthread_cond_t finished; // busy reached 0
+    unsigned int generation; // Bumped for every run
+    int busy;                // Workers still on the current run
+    bool quitting;
+    const ContactRun *run;
+};
+
+static void *worker_main(void *arg)
+{
+    WorkerStart *start = (WorkerStart *)arg;
+    ContactWorkers *workers = start->workers;
+    unsigned int seen = 0;
+
+    pthread_mutex_lock(&workers->lock);
+    for (;;)
+    {
+        while (workers->generation == seen && !workers->quitting)
+            pthread_cond_wait(&workers->wake, &workers->lock);
+        if (workers->quitting)
+            break;
+
+        seen = workers->generation;
+        const ContactRun *run = workers->run;
+        pthread_mutex_unlock(&workers->lock);
+
+        run_jobs(run, start->thread);
+
+        pthread_mutex_lock(&workers->lock);
+        if (--workers->busy == 0)
+            pthread_cond_signal(&workers->finished);
+    }
+    pthread_mutex_unlock(&workers->lock);
+    return NULL;
+}
+
+static ContactWorkers *workers_start(int count)
+{
+    ContactWorkers *workers = (ContactWorkers *)calloc(1, sizeof(ContactWorkers));
+    workers->threads = (pthread_t *)malloc(sizeof(pthread_t) * count);
+    workers->starts = (WorkerStart *)malloc(sizeof(WorkerStart) * count);
+    pthread_mutex_init(&workers->lock, NULL);
+    pthread_cond_init(&workers->wake, NULL);
+    pthread_cond_init(&workers->finished, NULL);
+
+    for (int i = 0; i < count; i++)
+    {
+        workers->starts[i] = (WorkerStart){workers, i + 1};
+        if (pthread_create(&workers->threads[i], NULL, worker_main, &workers->starts[i]) != 0)
+            break;
+        workers->count++;
+    }
+    return workers;
+}
+
+static void workers_stop(ContactWorkers *workers)
+{
+    pthread_mutex_lock(&workers->lock);
+    workers->quitting = true;
+    pthread_cond_broadcast(&workers->wake);
+    pthread_mutex_unlock(&workers->lock);
+    for (int i = 0; i < workers->count; i++)
+    {
+        pthread_join(workers->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&workers->finished);
+    pthread_cond_destroy(&workers->wake);
+    pthread_mutex_destroy(&workers->lock);
+    free(workers->starts);
+    free(workers->threads);
+    free(workers);
+}
+
+// The calling thread takes share 0 and waits for the workers to finish the rest
+static void workers_run(ContactWorkers *workers, const ContactRun *run)
+{
+    pthread_mutex_lock(&workers->lock);
+    workers->run = run;
+    workers->busy = workers->count;
+    workers->generation++;
+    pthread_cond_broadcast(&workers->wake);
+    pthread_mutex_unlock(&workers->lock);
+
+    run_jobs(run, 0);
+
+    pthread_mutex_lock(&workers->lock);
+    while (workers->busy > 0)
+        pthread_cond_wait(&workers->finished, &workers->lock);
+    pthread_mutex_unlock(&workers->lock);
+}
+#endif
+
+// ============ MERGE ============
+
+static bool contact_before(const Contact *a, const Contact *b)
+{
+    if (a->category != b->category)
+        return a->category < b->category;
+    if (a->first != b->first)
+        return a->first < b->first;
+    return a->second < b->second;
+}
+
+// Bottom-up merge sort; equal keys keep their order
+static void sort_contacts(ContactPipeline *pipeline)
+{
+    Contact *from = pipeline->contacts;
+    Contact *to = pipeline->scratch;
+    int count = pipeline->count;
+
+    for (int width = 1; width < count; width *= 2)
+    {
+        for (int left = 0; left < count; left += 2 * width)
+        {
+            int middle = left + width < count ? left + width : count;
+            int right = left + 2 * width < count ? left + 2 * width : count;
+            int i = left, j = middle, k = left;
+            while (i < middle && j < right)
+                to[k++] = contact_before(&from[j], &from[i]) ? from[j++] : from[i++];
+            while (i < middle)
+                to[k++] = from[i++];
+            while (j < right)
+                to[k++] = from[j++];
+        }
+        Contact *swap = from;
+        from = to;
+        to = swap;
+    }
+
+    if (from != pipeline->contacts)
+        memcpy(pipeline->contacts, from, sizeof(Contact) * count);
+}
+
+static bool is_sorted(const ContactPipeline *pipeline)
+{
+    for (int i = 1; i < pipeline->count; i++)
+    {
+        if (contact_before(&pipeline->contacts[i], &pipeline->contacts[i - 1]))
+            return false;
+    }
+    return true;
+}
+
+// ============ PIPELINE ============
+
+ContactPipeline contact_pipeline_create(int thread_count)
+{
+    ContactPipeline pipeline = {0};
+#ifdef CONTACT_WORKER_THREADS
+    pipeline.thread_count = thread_count > 1 ? thread_count : 1;
+    if (pipeline.thread_count > 1)
+    {
+        pipeline.workers = workers_start(pipeline.thread_count - 1);
+        pipeline.thread_count = pipeline.workers->count + 1; // Fewer if a thread failed to start
+    }
+#else
+    (void)thread_count;
+    pipeline.thread_count = 1;
+#endif
+    pipeline.buffers = (ContactBuffer *)calloc(pipeline.thread_count, sizeof(ContactBuffer));
+    return pipeline;
+}
+
+void contact_pipeline_cleanup(ContactPipeline *pipeline)
+{
+#ifdef CONTACT_WORKER_THREADS
+    if (pipeline->workers)
+        workers_stop(pipeline->workers);
+#endif
+    pipeline->workers = NULL;
+
+    for (int c = 0; c < CONTACT_CATEGORY_COUNT; c++)
+    {
+        free(pipeline->candidates[c]);
+        pipeline->candidates[c] = NULL;
+        pipeline->candidate_count[c] = 0;
+        pipeline->candidate_capacity[c] = 0;
+    }
+    for (int t = 0; t < pipeline->thread_count; t++)
+    {
+        free(pipeline->buffers[t].contacts);
+    }
+    free(pipeline->buffers);
+    pipeline->buffers = NULL;
+    pipeline->thread_count = 0;
+
+    free(pipeline->contacts);
+    free(pipeline->scratch);
+    pipeline->contacts = NULL;
+    pipeline->scratch = NULL;
+    pipeline->count = 0;
+    pipeline->capacity = 0;
+}
+
+void contact_pipeline_begin(ContactPipeline *pipeline)
+{
+    for (int c = 0; c < CONTACT_CATEGORY_COUNT; c++)
+    {
+        pipeline->candidate_count[c] = 0;
+    }
+}
+
+void contact_pipeline_add_candidates(ContactPipeline *pipeline, ContactCategory category,
+                                     const BroadphaseHit *hits, int count)
+{
+    if (count <= 0)
+        return;
+
+    int needed = pipeline->candidate_count[category] + count;
+    if (needed > pipeline->candidate_capacity[category])
+    {
+        int capacity = pipeline->candidate_capacity[category] * 2;
+        pipeline->candidate_capacity[category] = capacity > needed ? capacity : needed;
+        pipeline->candidates[category] = (BroadphaseHit *)realloc(pipeline->candidates[category],
+                                                                  sizeof(BroadphaseHit) * pipeline->candidate_capacity[category]);
+    }
+    memcpy(&pipeline->candidates[category][pipeline->candidate_count[category]], hits, sizeof(BroadphaseHit) * count);
+    pipeline->candidate_count[category] += count;
+}
+
+int contact_pipeline_run(ContactPipeline *pipeline, ContactTest test, void *context)
+{
+    ContactRun run = {pipeline, test, context, {0}, 1};
+    int total = 0;
+    for (int c = 0; c < CONTACT_CATEGORY_COUNT; c++)
+    {
+        int count = pipeline->candidate_count[c];
+        run.job_start[c + 1] = run.job_start[c] + (count + CONTACT_JOB_CANDIDATES - 1) / CONTACT_JOB_CANDIDATES;
+        total += count;
+    }
+
+#ifdef CONTACT_WORKER_THREADS
+    if (pipeline->workers && total >= CONTACT_PARALLEL_MIN)
+    {
+        run.thread_count = pipeline->thread_count;
+        workers_run(pipeline->workers, &run);
+    }
+    else
+#endif
+    {
+        run_jobs(&run, 0);
+    }
+
+    // Merge the buffers, then sort (a single buffer run in job order is sorted already)
+    int count = 0;
+    for (int t = 0; t < run.thread_count; t++)
+    {
+        count += pipeline->buffers[t].count;
+    }
+    if (count > pipeline->capacity)
+    {
+        pipeline->capacity = count > pipeline->capacity * 2 ? count : pipeline->capacity * 2;
+        pipeline->contacts = (Contact *)realloc(pipeline->contacts, sizeof(Contact) * pipeline->capacity);
+        pipeline->scratch = (Contact *)realloc(pipeline->scratch, sizeof(Contact) * pipeline->capacity);
+    }
+    pipeline->count = 0;
+    for (int t = 0; t < run.thread_count; t++)
+    {
+        const ContactBuffer *buffer = &pipeline->buffers[t];
+        if (buffer->count > 0)
+            memcpy(&pipeline->contacts[pipeline->count], buffer->contacts, sizeof(Contact) * buffer->count);
+        pipeline->count += buffer->count;
+    }
+    if (!is_sorted(pipeline))
+        sort_contacts(pipeline);
+
+    return pipeline->count;
+}
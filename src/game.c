@@ -2,19 +2,21 @@
 #include "player.h"
 #include "background.h"
 #include "level.h"
-#include "level_definitions.h"
 #include "hazard.h"
 #include "monster.h"
 #include "projectile.h"
 #include "pickup.h"
 #include "config.h"
-#include "dragon.h"
 #include "asset_paths.h"
+#include "texture_cache.h"
+#include "texture_atlas.h"
+#include "profiler.h"
+#include "profiler_overlay.h"
+#include "trace.h"
 #include <math.h>
 #include <stdlib.h>
 #include <stdio.h>
 
-static Player player;
 static Background background;
 
 // Helper function to draw all hearts UI with textures
@@ -24,21 +26,21 @@ static void draw_hearts_ui(Player *player, int screen_width, int screen_height)
     float spacing = 40.0f;    // Spacing between hearts
     float start_x = screen_width - 50.0f;
     float start_y = screen_height - 30.0f;
+    Sprite empty_heart = texture_cache_get_sprite(player->empty_heart_texture);
+    Sprite filled_heart = texture_cache_get_sprite(player->filled_heart_texture);
 
     // Draw max hearts first (empty hearts)
     for (int i = 0; i < player->max_hearts; i++)
     {
-        Rectangle source = {0, 0, (float)player->empty_heart_texture.width, (float)player->empty_heart_texture.height};
         Rectangle dest = {start_x - (i * spacing), start_y, heart_size, heart_size};
-        DrawTexturePro(player->empty_heart_texture, source, dest, (Vector2){heart_size / 2.0f, heart_size / 2.0f}, 0.0f, WHITE);
+        sprite_draw_pro(empty_heart, dest, (Vector2){heart_size / 2.0f, heart_size / 2.0f}, 0.0f, WHITE);
     }
 
     // Draw current hearts on top (filled hearts)
     for (int i = 0; i < player->hearts; i++)
     {
-        Rectangle source = {0, 0, (float)player->filled_heart_texture.width, (float)player->filled_heart_texture.height};
         Rectangle dest = {start_x - (i * spacing), start_y, heart_size, heart_size};
-        DrawTexturePro(player->filled_heart_texture, source, dest, (Vector2){heart_size / 2.0f, heart_size / 2.0f}, 0.0f, WHITE);
+        sprite_draw_pro(filled_heart, dest, (Vector2){heart_size / 2.0f, heart_size / 2.0f}, 0.0f, WHITE);
     }
 }
 
@@ -56,18 +58,18 @@ static void draw_loot_inventory_ui(Player *player, int screen_width)
     {
         int count = player->inventory.counts[i];
 
+        Sprite sprite = texture_cache_get_sprite(player->inventory.loot_textures[i]);
+
         // Skip if no items and no texture loaded
-        if (count == 0 && player->inventory.loot_textures[i].id == 0)
+        if (count == 0 && sprite.texture.id == 0)
             continue;
 
         // Skip if texture is not loaded
-        if (player->inventory.loot_textures[i].id == 0)
+        if (sprite.texture.id == 0)
             continue;
 
-        Texture2D texture = player->inventory.loot_textures[i];
-
         // Calculate width based on texture aspect ratio
-        float aspect_ratio = (float)texture.width / (float)texture.height;
+        float aspect_ratio = sprite.source.width / sprite.source.height;
         float icon_width = icon_height * aspect_ratio;
 
         // Position for this item (vertical stack)
@@ -82,9 +84,8 @@ static void draw_loot_inventory_ui(Player *player, int screen_width)
                       (Color){0, 0, 0, 100});
 
         // Draw item icon
-        Rectangle source = {0, 0, (float)texture.width, (float)texture.height};
         Rectangle dest = {item_x, item_y, icon_width, icon_height};
-        DrawTexturePro(texture, source, dest, (Vector2){icon_width / 2.0f, icon_height / 2.0f}, 0.0f, WHITE);
+        sprite_draw_pro(sprite, dest, (Vector2){icon_width / 2.0f, icon_height / 2.0f}, 0.0f, WHITE);
 
         // Draw count if > 0
         if (count > 0)
@@ -160,106 +161,12 @@ static void draw_goal_marker(Level *level, float camera_x)
     }
 }
 
-// Initialize levels for the game
-static void initialize_levels(GameState *state)
-{
-    state->level_count = 20; // Total number of levels
-
-    // Load levels from level definition files
-    state->levels[0] = level1_create();
-    state->levels[1] = level2_create();
-    state->levels[2] = level3_create();
-    state->levels[3] = level4_create();
-    state->levels[4] = level5_create();
-    state->levels[5] = level6_create();
-    state->levels[6] = level7_create();
-    state->levels[7] = level8_create();
-    state->levels[8] = level9_create();
-    state->levels[9] = level10_create();
-    state->levels[10] = level11_create();
-    state->levels[11] = level12_create();
-    state->levels[12] = level13_create();
-    state->levels[13] = level14_create();
-    state->levels[14] = level15_create();
-    state->levels[15] = level16_create();
-    state->levels[16] = level17_create();
-    state->levels[17] = level18_create();
-    state->levels[18] = level19_create();
-    state->levels[19] = level20_create();
-
-    state->current_level_index = 0;
-}
-
-// Helper function to initialize the loot system with default loot table
-static void init_loot_system(GameState *state)
-{
-    state->loot_system = loot_system_create();
-
-    // Create a default loot table for monsters
-    LootTable default_table = loot_table_create("DEFAULT", 4);
-
-    // Add loot items with drop chances and values
-    // Coins: 80% chance to drop 1 coin per monster kill
-    LootItemDef coin_def = {.type = LOOT_COIN, .drop_chance = 0.8f, .value = 1, .scale = 0.03f};
-    loot_table_add_item(&default_table, coin_def);
-
-    // Health Potions: 30% chance to drop 1 health potion
-    LootItemDef health_potion_def = {.type = LOOT_HEALTH_POTION, .drop_chance = 0.3f, .value = 1, .scale = 0.05f};
-    loot_table_add_item(&default_table, health_potion_def);
-
-    // Protection Potions: 15% chance to drop 1 protection potion
-    LootItemDef protection_potion_def = {.type = PROTECTION_POTION, .drop_chance = 0.15f, .value = 1, .scale = 0.04f};
-    loot_table_add_item(&default_table, protection_potion_def);
-
-    // Fireballs: 40% chance to drop 1 fireball
-    LootItemDef fireball_def = {.type = LOOT_FIREBALL, .drop_chance = 0.4f, .value = 1, .scale = 0.04f};
-    loot_table_add_item(&default_table, fireball_def);
-
-    // Set this as the default loot table for all monsters
-    loot_system_set_default_table(&state->loot_system, default_table);
-
-    // Custom loot table for boss in level 4
-    // boss is a special larger bat with higher drop rates and better loot
-    LootTable boss_table = loot_table_create("boss", 4);
-
-    // Coins: 95% chance to drop 2 coins (higher chance and value than regular bat)
-    LootItemDef boss_coin_def = {.type = LOOT_COIN, .drop_chance = 0.95f, .value = 2, .scale = 0.03f};
-    loot_table_add_item(&boss_table, boss_coin_def);
-
-    // Health Potions: 50% chance to drop 1 health potion (higher than default)
-    LootItemDef boss_health_potion_def = {.type = LOOT_HEALTH_POTION, .drop_chance = 0.5f, .value = 1, .scale = 0.05f};
-    loot_table_add_item(&boss_table, boss_health_potion_def);
-
-    // Protection Potions: 35% chance to drop 1 protection potion (higher than default)
-    LootItemDef boss_protection_potion_def = {.type = PROTECTION_POTION, .drop_chance = 0.35f, .value = 1, .scale = 0.04f};
-    loot_table_add_item(&boss_table, boss_protection_potion_def);
-    // Fireballs: 70% chance to drop 1 fireball (higher than default)
-    LootItemDef boss_fireball_def = {.type = LOOT_FIREBALL, .drop_chance = 0.7f, .value = 1, .scale = 0.04f};
-    loot_table_add_item(&boss_table, boss_fireball_def);
-
-    // Add the custom boss table to the loot system
-    loot_system_add_table(&state->loot_system, boss_table);
-}
-
 void game_init(GameState *state)
 {
-    state->screen_width = 1280;
+    state->screen_width = VIEW_WIDTH;
     state->screen_height = 720;
     state->fps = 60;
     state->running = true;
-    state->burnt_message_timer = 0.0f;
-    state->is_paused = false;
-    state->hazard_cooldown = 0.0f;
-    state->sword_attack_cooldown = 0.0f;
-    state->game_over = false;
-    state->last_collision_type = COLLISION_TYPE_NONE;
-    state->projectiles = projectile_list_create(100); // Max 100 projectiles active at once
-    state->in_level_transition = false;
-    state->next_level_index = 0;
-    state->game_victory = false;
-    state->victory_timer = 0.0f;
-    state->elapsed_time = 0.0f;
-    state->current_screen = GAME_SCREEN_TITLE;
     state->selected_menu_item = 1; // Start on "Start Game" menu item
     state->selected_level = 0;     // Default to Level 1 (index 0)
     state->pause_menu_active = false;
@@ -274,24 +181,85 @@ void game_init(GameState *state)
     SetTargetFPS(state->fps);
     SetExitKey(KEY_NULL); // Disable default ESC-to-close behavior so we can handle ESC for pause menu
 
-    // Load menu cursor texture (character.png)
-    state->menu_cursor_texture = LoadTexture(get_asset_path("character.png"));
+    // Pack all sprites into atlas pages so a frame draws from as few textures as possible.
+    // Must run before anything acquires textures from the cache.
+    texture_atlas_build();
 
-    // Initialize levels
-    initialize_levels(state);
+    // Load menu cursor texture (character.png)
+    state->menu_cursor_texture = texture_cache_acquire("character.png");
 
-    // Initialize loot system
-    init_loot_system(state);
+    // Levels, player and loot system
+    game_sim_init(state, CONTACT_THREADS);
 
-    // Initialize game objects
     Level *current_level = &state->levels[state->current_level_index];
-    player = player_create(current_level->player_start_position.x, current_level->player_start_position.y);
     background = background_create_with_variant(current_level->background.variant);
 }
 
-void game_update(GameState *state)
+// Sample keyboard and mouse into the simulation's input struct
+static PlayerInput poll_player_input(GameState *state)
 {
-    state->delta_time = GetFrameTime();
+    PlayerInput input = {0};
+    input.move_left = IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT);
+    input.move_right = IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT);
+    input.duck = IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN);
+    input.sword = IsKeyDown(KEY_LEFT_SHIFT);
+    input.jump = IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_W) || IsKeyPressed(KEY_UP);
+    input.use_health_potion = IsKeyPressed(KEY_H);
+    input.use_protection_potion = IsKeyPressed(KEY_P);
+
+    // Fire on left mouse click, aiming at the mouse position in world coordinates
+    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+    {
+        Vector2 mouse_pos = GetMousePosition();
+        input.fire = true;
+        input.fire_target = (Vector2){mouse_pos.x - GetScreenWidth() / 2.0f + background.camera.target.x, mouse_pos.y};
+    }
+
+    return input;
+}
+
+// Recreate the background for the level being played
+static void reset_background(GameState *state)
+{
+    Level *level = &state->levels[state->current_level_index];
+    TRACE_BEGIN("background_cleanup");
+    background_cleanup(&background);
+    TRACE_END("background_cleanup");
+    TRACE_BEGIN("background_create_with_variant");
+    background = background_create_with_variant(level->background.variant);
+    TRACE_END("background_create_with_variant");
+}
+
+void game_start_level(GameState *state, int level_index)
+{
+    TRACE_BEGIN("game_start_level");
+    game_sim_start_level(state, level_index);
+    reset_background(state);
+    TRACE_END("game_start_level");
+}
+
+void game_advance_level(GameState *state)
+{
+    TRACE_BEGIN("game_advance_level");
+    game_sim_advance_level(state);
+    reset_background(state);
+    TRACE_END("game_advance_level");
+}
+
+void game_update(GameState *state, PlayerInput *input)
+{
+#ifdef KNIGHT_PROFILER
+    if (IsKeyPressed(KEY_F3))
+    {
+        state->profiler_overlay_active = !state->profiler_overlay_active;
+    }
+#endif
+
+    // Gameplay presses only carry over while the simulation is running
+    if (!game_sim_is_active(state))
+    {
+        player_input_consume_presses(input);
+    }
 
     // Handle options menu first (before screen-specific handling)
     if (state->options_menu_active)
@@ -341,7 +309,7 @@ void game_update(GameState *state)
     if (state->current_screen == GAME_SCREEN_TITLE)
     {
         // Update background animation even on title screen
-        background_update(&background, (Vector2){0, 0});
+        background_update(&background, (Vector2){0, 0}, (Vector2){0, 0});
 
         // Menu navigation
         if (IsKeyPressed(KEY_UP))
@@ -372,32 +340,7 @@ void game_update(GameState *state)
             if (state->selected_menu_item == 1)
             {
                 // Start Game - use selected_level instead of 0
-                state->current_screen = GAME_SCREEN_PLAYING;
-                state->current_level_index = state->selected_level;
-                state->game_over = false;
-                state->game_victory = false;
-                state->elapsed_time = 0.0f;
-                state->is_paused = false;
-
-                // Reset player and level
-                Level *level = &state->levels[state->selected_level];
-                player.position = level->player_start_position;
-                player.velocity = (Vector2){0, 0};
-                player.hearts = player.max_hearts;
-                player.is_dead = false;
-                player_clear_damage_type(&player);
-                player.projectile_inventory = 0;
-
-                // Reactivate all enemies in all levels
-                for (int i = 0; i < state->level_count; i++)
-                {
-                    level_reactivate_enemies(&state->levels[i]);
-                    level_reset(&state->levels[i]);
-                }
-
-                // Reinitialize background
-                background_cleanup(&background);
-                background = background_create_with_variant(level->background.variant);
+                game_start_level(state, state->selected_level);
             }
             else if (state->selected_menu_item == 2)
             {
@@ -415,520 +358,32 @@ void game_update(GameState *state)
         return;
     }
 
-    // Increment elapsed time (always, even when paused, to track total play time)
-    if (!state->game_over && !state->game_victory)
-    {
-        state->elapsed_time += state->delta_time;
-    }
-
-    Level *current_level = &state->levels[state->current_level_index];
-
     // Handle level transition screen
     if (state->in_level_transition)
     {
         if (IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_ENTER))
         {
-            // Transition to next level
-            state->current_level_index = state->next_level_index;
-            state->in_level_transition = false;
-            state->is_paused = false;
-
-            Level *next_level = &state->levels[state->current_level_index];
-
-            // Reset player position to new level's start
-            player.position = next_level->player_start_position;
-            player.velocity = (Vector2){0, 0};
-            player.hearts = player.max_hearts; // Full health for new level
-            player.is_dead = false;            // Reset dead flag so damage can be taken
-            player_clear_damage_type(&player); // Reset any active damage effects
-            level_reset(next_level);
-
-            // Reinitialize background with new level's variant
-            background_cleanup(&background);
-            background = background_create_with_variant(next_level->background.variant);
-
-            // Update current_level reference
-            current_level = &state->levels[state->current_level_index];
+            game_advance_level(state);
         }
         return; // Don't process other updates during transition
     }
 
-    // Update all hazards (only if not paused and pause menu is not active)
-    if (!state->is_paused && !state->pause_menu_active)
-    {
-        for (int i = 0; i < current_level->hazards.count; i++)
-        {
-            hazard_update(&current_level->hazards.hazards[i]);
-        }
-    }
-
-    // Update game objects (only if not paused and pause menu is not active)
+    // Sample gameplay input once per frame; the fixed-rate simulation in game_step consumes it.
+    // Presses made while paused are dropped rather than replayed on resume.
     if (!state->is_paused && !state->pause_menu_active)
     {
-        player_handle_input(&player);
-        player_update_with_hazards(&player, &current_level->hazards);
-        player_update_sword_hitbox(&player);
-        background_update(&background, player.position);
-
-        // Update all monsters
-        for (int i = 0; i < current_level->monsters.count; i++)
-        {
-            monster_update(&current_level->monsters.monsters[i]);
-        }
-
-        // Update dragon AI - make dragons fire at the player
-        for (int i = 0; i < current_level->monsters.count; i++)
-        {
-            Monster *monster = &current_level->monsters.monsters[i];
-            // Check if this is a dragon (has custom_data allocated for dragon behavior)
-            if (monster->active && monster->custom_data != NULL && monster->custom_update == dragon_custom_update)
-            {
-                dragon_fire_at_target(monster, &state->projectiles, player.position);
-            }
-        }
-
-        // Handle projectile firing on left mouse click
-        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) && player.projectile_inventory > 0)
-        {
-            // Get mouse position in world coordinates
-            Vector2 mouse_pos = GetMousePosition();
-            float world_mouse_x = mouse_pos.x - GetScreenWidth() / 2.0f + background.camera.target.x;
-
-            // Create and fire a fireball projectile from player to mouse position
-            Projectile fireball = projectile_create_fireball(
-                (Vector2){player.position.x + player.width / 2.0f, player.position.y},
-                (Vector2){world_mouse_x, mouse_pos.y},
-                PROJECTILE_SOURCE_PLAYER);
-            projectile_list_add(&state->projectiles, fireball);
-            player.projectile_inventory--;            // Consume one projectile
-            player.inventory.counts[LOOT_FIREBALL]--; // Update inventory display
-        }
-
-        // Update all projectiles
-        for (int i = 0; i < state->projectiles.count; i++)
-        {
-            if (state->projectiles.projectiles[i].active)
-            {
-                projectile_update(&state->projectiles.projectiles[i]);
-            }
-        }
-
-        // Update all pickups
-        for (int i = 0; i < current_level->pickups.count; i++)
-        {
-            if (current_level->pickups.pickups[i].active)
-            {
-                pickup_update(&current_level->pickups.pickups[i]);
-            }
-        }
-
-        // Update loot items
-        loot_list_update(&current_level->loot);
-
-        // Update all spawners in the level (spawn new pickups on a timer)
-        for (int i = 0; i < current_level->spawners.count; i++)
-        {
-            pickup_spawner_update(&current_level->spawners.spawners[i], &current_level->pickups);
-        }
+        PROFILE_ZONE_BEGIN(PROFILE_ZONE_INPUT);
+        player_input_accumulate(input, poll_player_input(state));
+        PROFILE_ZONE_END(PROFILE_ZONE_INPUT);
     }
-    // Check for hazard collisions (only if cooldown expired)
-    Rectangle player_rect = {
-        player.position.x,
-        player.position.y,
-        player.width,
-        player.height};
-
-    if (state->hazard_cooldown <= 0.0f)
+    else
     {
-        for (int i = 0; i < current_level->hazards.count; i++)
-        {
-            Hazard *hazard = &current_level->hazards.hazards[i];
-            if (hazard->active && hazard_check_collision(hazard, player_rect) && hazard_is_dangerous(hazard))
-            {
-                // Only process collision if protection potion is not active
-                if (!player.protection_potion_active)
-                {
-                    // Player hit a hazard (only if it's dangerous/not faded out)
-                    player_take_damage(&player, hazard->damage);
-
-                    // Apply damage type based on hazard type
-                    DamageType damage_type = DAMAGE_TYPE_FIRE; // Default to fire
-                    float damage_duration = DAMAGE_DISPLAY_FIRE;
-
-                    switch (hazard->type)
-                    {
-                    case HAZARD_LAVA_PIT:
-                        damage_type = DAMAGE_TYPE_FIRE;
-                        damage_duration = DAMAGE_DISPLAY_FIRE;
-                        break;
-                    case HAZARD_DUST_STORM:
-                        damage_type = DAMAGE_TYPE_DUST;
-                        damage_duration = DAMAGE_DISPLAY_DUST;
-                        break;
-                    case HAZARD_SPIKE_TRAP:
-                        damage_type = DAMAGE_TYPE_MONSTER_HIT; // Spikes feel like sharp impacts
-                        damage_duration = DAMAGE_DISPLAY_MONSTER_HIT;
-                        break;
-                    case HAZARD_LAVA_JET:
-                        damage_type = DAMAGE_TYPE_FIRE;
-                        damage_duration = DAMAGE_DISPLAY_FIRE;
-                        break;
-                    case HAZARD_WIND_DAGGERS:
-                        damage_type = DAMAGE_TYPE_MONSTER_HIT;
-                        damage_duration = DAMAGE_DISPLAY_MONSTER_HIT;
-                        break;
-                    }
-
-                    player_apply_damage_type(&player, damage_type, damage_duration);
-                    state->burnt_message_timer = PAUSE_DURATION;        // Display message
-                    state->is_paused = true;                            // Pause the game
-                    state->hazard_cooldown = 3.0f;                      // Cooldown to prevent re-collision
-                    state->last_collision_type = COLLISION_TYPE_HAZARD; // Track collision type
-                    // Check if player is out of hearts
-                    if (player.hearts <= 0)
-                    {
-                        state->game_over = true; // Trigger game over
-                    }
-                }
-                else
-                {
-                    // Protection potion is active, consume it and set cooldown to prevent re-collision
-                    player_take_damage(&player, hazard->damage);
-                    state->hazard_cooldown = 3.0f; // 3 second cooldown to escape
-                }
-            }
-        }
-    }
-
-    // Check for monster collisions (also protected by cooldown)
-    if (state->hazard_cooldown <= 0.0f)
-    {
-        for (int i = 0; i < current_level->monsters.count; i++)
-        {
-            Monster *monster = &current_level->monsters.monsters[i];
-            if (state->sword_attack_cooldown <= 0.0f && monster->active && player.is_using_sword)
-            {
-                Rectangle monster_rect = {
-                    monster->position.x,
-                    monster->position.y,
-                    monster->width,
-                    monster->height};
-
-                if (CheckCollisionRecs(player.sword_hitbox, monster_rect))
-                {
-                    // Player hit monster with sword
-                    bool was_alive = monster->active;
-                    monster_take_damage(monster, 1);     // Sword deals 1 damage
-                    state->sword_attack_cooldown = 1.0f; // Set cooldown after attack
-
-                    // Generate loot if monster died
-                    if (was_alive && !monster->active)
-                    {
-                        // Generate loot drops
-                        LootTable *loot_table = loot_system_get_table_or_default(&state->loot_system, monster->type);
-                        LootList drops = generate_loot_drops(monster->position, loot_table, &player.inventory);
-                        for (int l = 0; l < drops.count; l++)
-                        {
-                            loot_list_add(&current_level->loot, drops.loot[l]);
-                        }
-                        loot_list_cleanup(&drops);
-                    }
-
-                    // Track defeated monsters for goal
-                    if (was_alive && !monster->active && current_level->goal.type == GOAL_TYPE_MONSTERS)
-                    {
-                        current_level->goal.monsters_defeated++;
-                    }
-                }
-            }
-
-            Rectangle player_rect = {
-                player.position.x,
-                player.position.y,
-                player.width,
-                player.height};
-
-            Rectangle monster_rect = {
-                monster->position.x,
-                monster->position.y,
-                monster->width,
-                monster->height};
-
-            if (monster->active && CheckCollisionRecs(player_rect, monster_rect))
-            {
-                // Only process collision if protection potion is not active
-                if (!player.protection_potion_active)
-                {
-                    // Player hit a monster
-                    player_take_damage(&player, 1); // Monsters deal 1 damage
-                    player_apply_damage_type(&player, DAMAGE_TYPE_MONSTER_HIT, DAMAGE_DISPLAY_MONSTER_HIT);
-
-                    // Pause the game and set cooldown
-                    state->burnt_message_timer = PAUSE_DURATION;         // Control pause duration
-                    state->is_paused = true;                             // Pause the game
-                    state->hazard_cooldown = 3.0f;                       // Cooldown to prevent re-collision
-                    state->last_collision_type = COLLISION_TYPE_MONSTER; // Track collision type
-
-                    // Check if player is out of hearts
-                    if (player.hearts <= 0)
-                    {
-                        state->game_over = true; // Trigger game over
-                    }
-                }
-                else
-                {
-                    // Protection potion is active, consume it and set cooldown to prevent re-collision
-                    player_take_damage(&player, 1);
-                    state->hazard_cooldown = 3.0f; // 3 second cooldown to escape
-                }
-            }
-        }
-    }
-
-    // Check for pickup collisions
-    for (int i = 0; i < current_level->pickups.count; i++)
-    {
-        Pickup *pickup = &current_level->pickups.pickups[i];
-        if (pickup->active)
-        {
-            Rectangle pickup_rect = {
-                pickup->position.x - (pickup->width * pickup->scale) / 2.0f,
-                pickup->position.y - (pickup->height * pickup->scale) / 2.0f,
-                pickup->width * pickup->scale,
-                pickup->height * pickup->scale};
-
-            if (CheckCollisionRecs(player_rect, pickup_rect))
-            {
-                // Player picked up fireball
-                if (pickup->type == PICKUP_FIREBALL)
-                {
-                    player.inventory.counts[LOOT_FIREBALL] += pickup->value;
-                    player.projectile_inventory += pickup->value;
-
-                    // Cap at max
-                    if (player.inventory.counts[LOOT_FIREBALL] > player.max_projectiles)
-                    {
-                        player.inventory.counts[LOOT_FIREBALL] = player.max_projectiles;
-                    }
-                    if (player.projectile_inventory > player.max_projectiles)
-                    {
-                        player.projectile_inventory = player.max_projectiles;
-                    }
-                }
-
-                // Deactivate pickup
-                pickup->active = false;
-            }
-        }
-    }
-
-    // Check for loot-player collisions
-    for (int i = 0; i < current_level->loot.count; i++)
-    {
-        Loot *loot = &current_level->loot.loot[i];
-        if (loot->active)
-        {
-            Rectangle loot_rect = {
-                loot->position.x - (loot->texture.width * loot->scale) / 2.0f,
-                loot->position.y - (loot->texture.height * loot->scale) / 2.0f,
-                loot->texture.width * loot->scale,
-                loot->texture.height * loot->scale};
-
-            if (CheckCollisionRecs(player_rect, loot_rect))
-            {
-                // Player picked up loot - add to inventory
-                inventory_add_loot(&player.inventory, loot->type, loot->value);
-
-                // Handle special case for fireballs - also add to projectile inventory
-                if (loot->type == LOOT_FIREBALL)
-                {
-                    player.projectile_inventory += loot->value;
-
-                    // Cap at max
-                    if (player.inventory.counts[LOOT_FIREBALL] > player.max_projectiles)
-                    {
-                        player.inventory.counts[LOOT_FIREBALL] = player.max_projectiles;
-                    }
-                    if (player.projectile_inventory > player.max_projectiles)
-                    {
-                        player.projectile_inventory = player.max_projectiles;
-                    }
-                }
-
-                // Deactivate loot
-                loot->active = false;
-            }
-        }
-    }
-
-    // Check for projectile-monster collisions (only player projectiles hit monsters)
-    for (int p = 0; p < state->projectiles.count; p++)
-    {
-        Projectile *projectile = &state->projectiles.projectiles[p];
-        if (!projectile->active || projectile->source != PROJECTILE_SOURCE_PLAYER)
-            continue;
-
-        Rectangle projectile_rect = {
-            projectile->position.x,
-            projectile->position.y,
-            projectile->width,
-            projectile->height};
-
-        for (int m = 0; m < current_level->monsters.count; m++)
-        {
-            Monster *monster = &current_level->monsters.monsters[m];
-            if (!monster->active)
-                continue;
-
-            Rectangle monster_rect = {
-                monster->position.x,
-                monster->position.y,
-                monster->width,
-                monster->height};
-
-            if (CheckCollisionRecs(projectile_rect, monster_rect))
-            {
-                // Projectile hit monster
-                bool was_alive = monster->active;
-                monster_take_damage(monster, 1); // Each projectile deals 1 damage
-                projectile->active = false;      // Destroy projectile on impact
-
-                // Generate loot if monster died
-                if (was_alive && !monster->active)
-                {
-                    // Generate loot drops
-                    LootTable *loot_table = loot_system_get_table_or_default(&state->loot_system, monster->type);
-                    LootList drops = generate_loot_drops(monster->position, loot_table, &player.inventory);
-                    for (int l = 0; l < drops.count; l++)
-                    {
-                        loot_list_add(&current_level->loot, drops.loot[l]);
-                    }
-                    loot_list_cleanup(&drops);
-                }
-
-                // Track defeated monsters for goal
-                if (was_alive && !monster->active && current_level->goal.type == GOAL_TYPE_MONSTERS)
-                {
-                    current_level->goal.monsters_defeated++;
-                }
-            }
-        }
-    }
-
-    // Check for monster projectile-player collisions
-    for (int p = 0; p < state->projectiles.count; p++)
-    {
-        Projectile *projectile = &state->projectiles.projectiles[p];
-
-        if (projectile_check_player_collision(projectile, player_rect))
-        {
-            // Only process collision if protection potion is not active
-            if (!player.protection_potion_active)
-            {
-                // Monster projectile hit player
-                player_take_damage(&player, 1); // Each projectile deals 1 damage
-
-                // Apply fire damage type (projectiles are fire-based)
-                player_apply_damage_type(&player, DAMAGE_TYPE_FIRE, DAMAGE_DISPLAY_FIRE);
-                state->burnt_message_timer = PAUSE_DURATION;        // Display message
-                state->is_paused = true;                            // Pause the game
-                state->hazard_cooldown = 3.0f;                      // Cooldown to prevent re-collision
-                state->last_collision_type = COLLISION_TYPE_HAZARD; // Track collision type
-
-                // Check if player is out of hearts
-                if (player.hearts <= 0)
-                {
-                    state->game_over = true; // Trigger game over
-                }
-            }
-            else
-            {
-                // Protection potion is active, consume it and prevent collision sequence
-                player_take_damage(&player, 1);
-            }
-
-            projectile->active = false; // Destroy projectile on impact
-        }
-    }
-
-    // Update hazard cooldown (skip if pause menu is active)
-    if (state->hazard_cooldown > 0.0f && !state->pause_menu_active)
-    {
-        state->hazard_cooldown -= state->delta_time;
-    }
-
-    // update sword attack cooldown (skip if pause menu is active)
-    if (state->sword_attack_cooldown > 0.0f && !state->pause_menu_active)
-    {
-        state->sword_attack_cooldown -= state->delta_time;
-    }
-
-    // Update burnt message timer (skip if pause menu is active)
-    if (state->burnt_message_timer > 0.0f && !state->pause_menu_active)
-    {
-        state->burnt_message_timer -= state->delta_time;
-    }
-    else if (state->is_paused && !state->pause_menu_active)
-    {
-        // Timer expired, resume game and respawn
-        state->is_paused = false;
-
-        // Respawn player at level start
-        player.position = current_level->player_start_position;
-        player.velocity = (Vector2){0, 0};
-        player_clear_damage_type(&player); // Clear any active damage effects on respawn
-    }
-
-    // Update game over timer
-    if (state->game_over)
-    {
-        // When burnt message timer expires and game is over, return to title screen
-        if (state->burnt_message_timer <= 0.0f)
-        {
-            // Return to title screen
-            state->current_screen = GAME_SCREEN_TITLE;
-            state->game_over = false;
-            state->selected_menu_item = 1; // Default to "Start Game"
-            state->selected_level = 0;     // Reset to level 1
-            state->hazard_cooldown = 0.0f;
-            player.hearts = player.max_hearts;
-            player.is_dead = false;
-            player_clear_damage_type(&player);
-            player.projectile_inventory = 0;
-
-            // Reactivate all enemies for next playthrough
-            for (int i = 0; i < state->level_count; i++)
-            {
-                level_reactivate_enemies(&state->levels[i]);
-                level_reset(&state->levels[i]);
-            }
-        }
-    }
-
-    // Check if level goal is reached
-    if (level_check_goal_reached(current_level, player.position))
-    {
-        // Move to next level
-        if (state->current_level_index < state->level_count - 1)
-        {
-            // Start level transition screen
-            state->in_level_transition = true;
-            state->next_level_index = state->current_level_index + 1;
-            state->is_paused = true; // Pause game during transition
-        }
-        else
-        {
-            // Game complete - show victory screen
-            state->game_victory = true;
-            state->victory_timer = 0.0f;
-            state->is_paused = true;
-        }
+        player_input_consume_presses(input);
     }
 
     // Handle victory state
     if (state->game_victory)
     {
-        state->victory_timer += state->delta_time;
         if (IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_ESCAPE))
         {
             // Return to title screen after victory
@@ -944,7 +399,7 @@ void game_update(GameState *state)
             for (int i = 0; i < state->level_count; i++)
             {
                 level_reactivate_enemies(&state->levels[i]);
-                level_reset(&state->levels[i]);
+                level_reset(&state->levels[i], &state->world_timers);
             }
         }
     }
@@ -1001,7 +456,7 @@ void game_update(GameState *state)
                 for (int i = 0; i < state->level_count; i++)
                 {
                     level_reactivate_enemies(&state->levels[i]);
-                    level_reset(&state->levels[i]);
+                    level_reset(&state->levels[i], &state->world_timers);
                 }
             }
         }
@@ -1147,6 +602,7 @@ static void draw_title_screen(GameState *state)
     float menu_start_y = screen_height / 2 + 20;
     float menu_item_height = 70.0f;
     float character_offset_x = -200.0f; // Offset to the left of menu items
+    Sprite cursor_sprite = texture_cache_get_sprite(state->menu_cursor_texture);
 
     // Draw menu items
     // Item 0: Select Level
@@ -1161,15 +617,14 @@ static void draw_title_screen(GameState *state)
         DrawText(level_text, text_x, (int)item_y, 40, text_color);
 
         // Draw character cursor for selected item
-        if (0 == state->selected_menu_item && state->menu_cursor_texture.width > 0)
+        if (0 == state->selected_menu_item && cursor_sprite.texture.id > 0)
         {
             float cursor_x = text_x + character_offset_x;
             float cursor_y = item_y;
             float cursor_size = 40.0f;
 
-            Rectangle source = {0, 0, (float)state->menu_cursor_texture.width, (float)state->menu_cursor_texture.height};
             Rectangle dest = {cursor_x, cursor_y, cursor_size, cursor_size};
-            DrawTexturePro(state->menu_cursor_texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+            sprite_draw_pro(cursor_sprite, dest, (Vector2){0, 0}, 0.0f, WHITE);
         }
 
         // Draw left/right navigation hint for level selector
@@ -1193,15 +648,14 @@ static void draw_title_screen(GameState *state)
         DrawText(menu_text, text_x, (int)item_y, 40, text_color);
 
         // Draw character cursor for selected item
-        if (1 == state->selected_menu_item && state->menu_cursor_texture.width > 0)
+        if (1 == state->selected_menu_item && cursor_sprite.texture.id > 0)
         {
             float cursor_x = text_x + character_offset_x;
             float cursor_y = item_y;
             float cursor_size = 40.0f;
 
-            Rectangle source = {0, 0, (float)state->menu_cursor_texture.width, (float)state->menu_cursor_texture.height};
             Rectangle dest = {cursor_x, cursor_y, cursor_size, cursor_size};
-            DrawTexturePro(state->menu_cursor_texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+            sprite_draw_pro(cursor_sprite, dest, (Vector2){0, 0}, 0.0f, WHITE);
         }
     }
 
@@ -1216,15 +670,14 @@ static void draw_title_screen(GameState *state)
         DrawText(menu_text, text_x, (int)item_y, 40, text_color);
 
         // Draw character cursor for selected item
-        if (2 == state->selected_menu_item && state->menu_cursor_texture.width > 0)
+        if (2 == state->selected_menu_item && cursor_sprite.texture.id > 0)
         {
             float cursor_x = text_x + character_offset_x;
             float cursor_y = item_y;
             float cursor_size = 40.0f;
 
-            Rectangle source = {0, 0, (float)state->menu_cursor_texture.width, (float)state->menu_cursor_texture.height};
             Rectangle dest = {cursor_x, cursor_y, cursor_size, cursor_size};
-            DrawTexturePro(state->menu_cursor_texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+            sprite_draw_pro(cursor_sprite, dest, (Vector2){0, 0}, 0.0f, WHITE);
         }
     }
 
@@ -1239,15 +692,14 @@ static void draw_title_screen(GameState *state)
         DrawText(menu_text, text_x, (int)item_y, 40, text_color);
 
         // Draw character cursor for selected item
-        if (3 == state->selected_menu_item && state->menu_cursor_texture.width > 0)
+        if (3 == state->selected_menu_item && cursor_sprite.texture.id > 0)
         {
             float cursor_x = text_x + character_offset_x;
             float cursor_y = item_y;
             float cursor_size = 40.0f;
 
-            Rectangle source = {0, 0, (float)state->menu_cursor_texture.width, (float)state->menu_cursor_texture.height};
             Rectangle dest = {cursor_x, cursor_y, cursor_size, cursor_size};
-            DrawTexturePro(state->menu_cursor_texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+            sprite_draw_pro(cursor_sprite, dest, (Vector2){0, 0}, 0.0f, WHITE);
         }
     }
 
@@ -1353,6 +805,7 @@ static void draw_pause_menu(GameState *state)
     float menu_start_y = screen_height / 2 + 20;
     float menu_item_height = 70.0f;
     float character_offset_x = -180.0f; // Offset to the left of menu items
+    Sprite cursor_sprite = texture_cache_get_sprite(state->menu_cursor_texture);
 
     // Draw menu items
     for (int i = 0; i < 3; i++)
@@ -1366,15 +819,14 @@ static void draw_pause_menu(GameState *state)
         DrawText(menu_items[i], text_x, (int)item_y, 40, text_color);
 
         // Draw character cursor for selected item
-        if (i == state->pause_menu_selection && state->menu_cursor_texture.width > 0)
+        if (i == state->pause_menu_selection && cursor_sprite.texture.id > 0)
         {
             float cursor_x = text_x + character_offset_x;
             float cursor_y = item_y;
             float cursor_size = 40.0f;
 
-            Rectangle source = {0, 0, (float)state->menu_cursor_texture.width, (float)state->menu_cursor_texture.height};
             Rectangle dest = {cursor_x, cursor_y, cursor_size, cursor_size};
-            DrawTexturePro(state->menu_cursor_texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+            sprite_draw_pro(cursor_sprite, dest, (Vector2){0, 0}, 0.0f, WHITE);
         }
     }
 
@@ -1386,7 +838,7 @@ static void draw_pause_menu(GameState *state)
     DrawText(instructions, instr_x, instr_y, 16, LIGHTGRAY);
 }
 
-void game_draw(GameState *state)
+void game_draw(GameState *state, float alpha)
 {
     BeginDrawing();
     ClearBackground(RAYWHITE);
@@ -1423,28 +875,44 @@ void game_draw(GameState *state)
         return;
     }
 
+    // Blend the player between the last two simulation ticks so motion stays smooth
+    // when the display rate does not match SIMULATION_TICK_RATE, and point the camera at it.
+    // Everything drawn in the world is blended the same way so it holds still against the
+    // camera. While the world is stopped nothing moves, so the latest positions are drawn.
+    if (state->is_paused || state->pause_menu_active)
+    {
+        alpha = 1.0f;
+    }
+    Player render_player = state->player;
+    render_player.position.x = state->player.previous_position.x + (state->player.position.x - state->player.previous_position.x) * alpha;
+    render_player.position.y = state->player.previous_position.y + (state->player.position.y - state->player.previous_position.y) * alpha;
+    background_update(&background, render_player.position, state->player.velocity);
+
     // Draw background with hazard gaps
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_DRAW_BACKGROUND);
     Level *current_level = &state->levels[state->current_level_index];
     background_draw_with_hazards(&background, &current_level->hazards);
+    PROFILE_ZONE_END(PROFILE_ZONE_DRAW_BACKGROUND);
 
     // Draw hazards
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_DRAW_ENTITIES);
     for (int i = 0; i < current_level->hazards.count; i++)
     {
-        hazard_draw(&current_level->hazards.hazards[i], background.camera.target.x);
+        hazard_draw(&current_level->hazards.hazards[i], background.camera.target.x, level_time(current_level));
     }
 
     // Draw monsters
-    for (int i = 0; i < current_level->monsters.count; i++)
-    {
-        monster_draw(&current_level->monsters.monsters[i], background.camera.target.x);
-    }
+    monster_list_draw(&current_level->monsters, background.camera.target.x, alpha);
 
     // Draw projectiles
     for (int i = 0; i < state->projectiles.count; i++)
     {
         if (state->projectiles.projectiles[i].active)
         {
-            projectile_draw(&state->projectiles.projectiles[i], background.camera.target.x);
+            Projectile render_projectile = state->projectiles.projectiles[i];
+            render_projectile.position.x = render_projectile.previous_position.x + (render_projectile.position.x - render_projectile.previous_position.x) * alpha;
+            render_projectile.position.y = render_projectile.previous_position.y + (render_projectile.position.y - render_projectile.previous_position.y) * alpha;
+            projectile_draw(&render_projectile, background.camera.target.x);
         }
     }
 
@@ -1453,29 +921,35 @@ void game_draw(GameState *state)
     {
         if (current_level->pickups.pickups[i].active)
         {
-            pickup_draw(&current_level->pickups.pickups[i], background.camera.target.x);
+            Pickup render_pickup = current_level->pickups.pickups[i];
+            render_pickup.position.x = render_pickup.previous_position.x + (render_pickup.position.x - render_pickup.previous_position.x) * alpha;
+            render_pickup.position.y = render_pickup.previous_position.y + (render_pickup.position.y - render_pickup.previous_position.y) * alpha;
+            pickup_draw(&render_pickup, background.camera.target.x);
         }
     }
 
     // Draw loot items
-    loot_list_draw(&current_level->loot, background.camera.target.x);
+    loot_list_draw(&current_level->loot, background.camera.target.x, alpha);
 
     // Draw goal marker
     draw_goal_marker(current_level, background.camera.target.x);
 
     // Draw game objects
-    player_draw(&player, background.camera.target.x);
+    player_draw(&render_player, background.camera.target.x);
+    PROFILE_ZONE_END(PROFILE_ZONE_DRAW_ENTITIES);
 
     // Draw UI
-    draw_hearts_ui(&player, state->screen_width, state->screen_height);
-    draw_loot_inventory_ui(&player, state->screen_width);
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_DRAW_UI);
+    draw_hearts_ui(&state->player, state->screen_width, state->screen_height);
+    draw_loot_inventory_ui(&state->player, state->screen_width);
     draw_level_ui(state);
 
     // Draw damage message if active (and game over message if applicable)
-    if (state->burnt_message_timer > 0.0f)
+    float message_time = timer_wheel_remaining(&state->timers, state->burnt_message_timer);
+    if (message_time > 0.0f)
     {
         // Flashing effect based on timer
-        float alpha = (state->burnt_message_timer > 1.0f) ? 255.0f : (state->burnt_message_timer * 255.0f);
+        float alpha = (message_time > 1.0f) ? 255.0f : (message_time * 255.0f);
         Color message_color = (Color){255, 100, 0, (unsigned char)alpha}; // Orange color
 
         if (state->game_over)
@@ -1489,7 +963,7 @@ void game_draw(GameState *state)
         }
 
         // Display appropriate damage message based on damage type
-        const char *damage_message = damage_type_get_message(player.active_damage_type);
+        const char *damage_message = damage_type_get_message(state->player.active_damage_type);
 
         int message_text_width = MeasureText(damage_message, 40);
         int message_center_x = (state->screen_width - message_text_width) / 2;
@@ -1505,26 +979,41 @@ void game_draw(GameState *state)
     {
         draw_pause_menu(state);
     }
+    PROFILE_ZONE_END(PROFILE_ZONE_DRAW_UI);
+
+#ifdef KNIGHT_PROFILER
+    if (state->profiler_overlay_active)
+    {
+        profiler_overlay_draw(state->screen_width - 390, 10);
+        if (state->current_screen == GAME_SCREEN_PLAYING)
+        {
+            // What the sector window left out of the last tick
+            const SectorStats *sectors = &state->sector_stats;
+            DrawText(TextFormat("sectors awake %d  skipped %d: hazards %d monsters %d pickups %d loot %d spawners %d",
+                                sectors->active_sectors, sector_stats_skipped(sectors), sectors->hazards_skipped,
+                                sectors->monsters_skipped, sectors->pickups_skipped, sectors->loot_skipped,
+                                sectors->spawners_skipped),
+                     10, 34, 10, WHITE);
+        }
+    }
+#endif
 
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_PRESENT);
     EndDrawing();
+    PROFILE_ZONE_END(PROFILE_ZONE_PRESENT);
 }
 
 void game_cleanup(GameState *state)
 {
-    player_cleanup(&player);
     background_cleanup(&background);
 
-    // Unload menu cursor texture
-    if (state->menu_cursor_texture.width > 0)
-    {
-        UnloadTexture(state->menu_cursor_texture);
-    }
+    // Release menu cursor texture
+    texture_cache_release(state->menu_cursor_texture);
 
-    // Cleanup all levels
-    for (int i = 0; i < state->level_count; i++)
-    {
-        level_cleanup(&state->levels[i]);
-    }
+    game_sim_cleanup(state);
+
+    // Free any textures still held by the cache before the GL context goes away
+    texture_cache_shutdown();
 
     CloseWindow();
 }
@@ -0,0 +1,50 @@
+#include "game_events.h"
+#include <stdlib.h>
+
+GameEventQueue game_event_queue_create(int capacity)
+{
+    GameEventQueue queue = {0};
+    queue.capacity = capacity > 0 ? capacity : 1;
+    queue.events = (GameEvent *)malloc(sizeof(GameEvent) * queue.capacity);
+    return queue;
+}
+
+void game_event_queue_cleanup(GameEventQueue *queue)
+{
+    free(queue->events);
+    queue->events = NULL;
+    queue->count = 0;
+    queue->capacity = 0;
+}
+
+void game_event_queue_clear(GameEventQueue *queue)
+{
+    queue->count = 0;
+}
+
+static GameEvent *append(GameEventQueue *queue)
+{
+    if (queue->count >= queue->capacity)
+    {
+        queue->capacity = queue->capacity > 0 ? queue->capacity * 2 : 8;
+        queue->events = (GameEvent *)realloc(queue->events, sizeof(GameEvent) * queue->capacity);
+    }
+    GameEvent *event = &queue->events[queue->count++];
+    *event = (GameEvent){0};
+    return event;
+}
+
+void game_event_push(GameEventQueue *queue, GameEventType type, int index)
+{
+    GameEvent *event = append(queue);
+    event->type = type;
+    event->index = index;
+}
+
+void game_event_push_player_hit(GameEventQueue *queue, PlayerHit hit)
+{
+    GameEvent *event = append(queue);
+    event->type = GAME_EVENT_PLAYER_HIT;
+    event->index = -1;
+    event->hit = hit;
+}
@@ -0,0 +1,893 @@
+#include "game.h"
+#include "player.h"
+#include "level.h"
+#include "level_definitions.h"
+#include "hazard.h"
+#include "monster.h"
+#include "projectile.h"
+#include "pickup.h"
+#include "config.h"
+#include "loot.h"
+#include "sim_clock.h"
+#include "profiler.h"
+#include "collision.h"
+#include <stdlib.h>
+
+// Game simulation: levels, player, enemies, collisions and timers.
+// Nothing in here opens a window, touches the GPU or polls input, so it can run headless.
+
+// Initialize levels for the game
+static void initialize_levels(GameState *state)
+{
+    state->level_count = 20; // Total number of levels
+
+    // Load levels from level definition files
+    state->levels[0] = level1_create();
+    state->levels[1] = level2_create();
+    state->levels[2] = level3_create();
+    state->levels[3] = level4_create();
+    state->levels[4] = level5_create();
+    state->levels[5] = level6_create();
+    state->levels[6] = level7_create();
+    state->levels[7] = level8_create();
+    state->levels[8] = level9_create();
+    state->levels[9] = level10_create();
+    state->levels[10] = level11_create();
+    state->levels[11] = level12_create();
+    state->levels[12] = level13_create();
+    state->levels[13] = level14_create();
+    state->levels[14] = level15_create();
+    state->levels[15] = level16_create();
+    state->levels[16] = level17_create();
+    state->levels[17] = level18_create();
+    state->levels[18] = level19_create();
+    state->levels[19] = level20_create();
+
+    // Create every spawner's pickups up front so spawning never loads a texture
+    for (int i = 0; i < state->level_count; i++)
+    {
+        pickup_pool_prewarm(&state->levels[i].pickup_pool, &state->levels[i].spawners);
+    }
+
+    state->current_level_index = 0;
+}
+
+// Helper function to initialize the loot system with default loot table
+static void init_loot_system(GameState *state)
+{
+    state->loot_system = loot_system_create();
+
+    // Create a default loot table for monsters
+    LootTable default_table = loot_table_create("DEFAULT", 4);
+
+    // Add loot items with drop chances and values
+    // Coins: 80% chance to drop 1 coin per monster kill
+    LootItemDef coin_def = {.type = LOOT_COIN, .drop_chance = 0.8f, .value = 1, .scale = 0.03f};
+    loot_table_add_item(&default_table, coin_def);
+
+    // Health Potions: 30% chance to drop 1 health potion
+    LootItemDef health_potion_def = {.type = LOOT_HEALTH_POTION, .drop_chance = 0.3f, .value = 1, .scale = 0.05f};
+    loot_table_add_item(&default_table, health_potion_def);
+
+    // Protection Potions: 15% chance to drop 1 protection potion
+    LootItemDef protection_potion_def = {.type = PROTECTION_POTION, .drop_chance = 0.15f, .value = 1, .scale = 0.04f};
+    loot_table_add_item(&default_table, protection_potion_def);
+
+    // Fireballs: 40% chance to drop 1 fireball
+    LootItemDef fireball_def = {.type = LOOT_FIREBALL, .drop_chance = 0.4f, .value = 1, .scale = 0.04f};
+    loot_table_add_item(&default_table, fireball_def);
+
+    // Set this as the default loot table for all monsters
+    loot_system_set_default_table(&state->loot_system, default_table);
+
+    // Custom loot table for boss in level 4
+    // boss is a special larger bat with higher drop rates and better loot
+    LootTable boss_table = loot_table_create("boss", 4);
+
+    // Coins: 95% chance to drop 2 coins (higher chance and value than regular bat)
+    LootItemDef boss_coin_def = {.type = LOOT_COIN, .drop_chance = 0.95f, .value = 2, .scale = 0.03f};
+    loot_table_add_item(&boss_table, boss_coin_def);
+
+    // Health Potions: 50% chance to drop 1 health potion (higher than default)
+    LootItemDef boss_health_potion_def = {.type = LOOT_HEALTH_POTION, .drop_chance = 0.5f, .value = 1, .scale = 0.05f};
+    loot_table_add_item(&boss_table, boss_health_potion_def);
+
+    // Protection Potions: 35% chance to drop 1 protection potion (higher than default)
+    LootItemDef boss_protection_potion_def = {.type = PROTECTION_POTION, .drop_chance = 0.35f, .value = 1, .scale = 0.04f};
+    loot_table_add_item(&boss_table, boss_protection_potion_def);
+    // Fireballs: 70% chance to drop 1 fireball (higher than default)
+    LootItemDef boss_fireball_def = {.type = LOOT_FIREBALL, .drop_chance = 0.7f, .value = 1, .scale = 0.04f};
+    loot_table_add_item(&boss_table, boss_fireball_def);
+
+    // Add the custom boss table to the loot system
+    loot_system_add_table(&state->loot_system, boss_table);
+}
+
+// The hit pause is over: resume and respawn the player at the level start
+static void hit_pause_over(void *context, int arg)
+{
+    (void)arg;
+    GameState *state = (GameState *)context;
+    Level *current_level = &state->levels[state->current_level_index];
+
+    state->is_paused = false;
+    state->player.position = current_level->player_start_position;
+    state->player.velocity = (Vector2){0, 0};
+    state->player.previous_position = state->player.position;
+    player_clear_damage_type(&state->player, &state->world_timers); // Clear any active damage effects on respawn
+}
+
+// Pause after a hit and show the damage message for PAUSE_DURATION
+static void start_hit_pause(GameState *state)
+{
+    timer_wheel_restart(&state->timers, &state->burnt_message_timer, timer_ticks(PAUSE_DURATION), hit_pause_over, state, 0);
+    state->is_paused = true;
+}
+
+// ============ GAMEPLAY EVENTS ============
+
+// How a hazard hurts the player who touches it
+static PlayerHit hazard_hit(const Hazard *hazard)
+{
+    PlayerHit hit = {hazard->damage, DAMAGE_TYPE_FIRE, DAMAGE_DISPLAY_FIRE, COLLISION_TYPE_HAZARD, true}; // Default to fire
+
+    switch (hazard->type)
+    {
+    case HAZARD_LAVA_PIT:
+        hit.damage_type = DAMAGE_TYPE_FIRE;
+        hit.display_duration = DAMAGE_DISPLAY_FIRE;
+        break;
+    case HAZARD_DUST_STORM:
+        hit.damage_type = DAMAGE_TYPE_DUST;
+        hit.display_duration = DAMAGE_DISPLAY_DUST;
+        break;
+    case HAZARD_SPIKE_TRAP:
+        hit.damage_type = DAMAGE_TYPE_MONSTER_HIT; // Spikes feel like sharp impacts
+        hit.display_duration = DAMAGE_DISPLAY_MONSTER_HIT;
+        break;
+    case HAZARD_LAVA_JET:
+        hit.damage_type = DAMAGE_TYPE_FIRE;
+        hit.display_duration = DAMAGE_DISPLAY_FIRE;
+        break;
+    case HAZARD_WIND_DAGGERS:
+        hit.damage_type = DAMAGE_TYPE_MONSTER_HIT;
+        hit.display_duration = DAMAGE_DISPLAY_MONSTER_HIT;
+        break;
+    }
+    return hit;
+}
+
+static void handle_player_hit(GameState *state, const PlayerHit *hit)
+{
+    // One contact hit per cooldown: an earlier hit this tick may already have started it
+    if (hit->contact && timer_wheel_pending(&state->timers, state->hazard_cooldown))
+        return;
+
+    if (state->player.protection_potion_active)
+    {
+        // Protection potion is active: the hit consumes it. Contact hits also start the
+        // cooldown so the player can get away.
+        player_take_damage(&state->player, hit->damage);
+        if (hit->contact)
+        {
+            timer_wheel_restart(&state->timers, &state->hazard_cooldown, timer_ticks(3.0f), NULL, NULL, 0); // 3 second cooldown to escape
+        }
+        return;
+    }
+
+    player_take_damage(&state->player, hit->damage);
+    player_apply_damage_type(&state->player, &state->world_timers, hit->damage_type, hit->display_duration);
+    start_hit_pause(state); // Display message and pause the game
+    timer_wheel_restart(&state->timers, &state->hazard_cooldown, timer_ticks(3.0f), NULL, NULL, 0); // Cooldown to prevent re-collision
+    state->last_collision_type = hit->collision_type;
+
+    // Check if player is out of hearts
+    if (state->player.hearts <= 0)
+    {
+        state->game_over = true; // Trigger game over
+    }
+}
+
+// Fireballs picked up as pickups or loot never take the player past the maximum
+static void cap_fireballs(Player *player)
+{
+    if (player->inventory.counts[LOOT_FIREBALL] > player->max_projectiles)
+    {
+        player->inventory.counts[LOOT_FIREBALL] = player->max_projectiles;
+    }
+    if (player->projectile_inventory > player->max_projectiles)
+    {
+        player->projectile_inventory = player->max_projectiles;
+    }
+}
+
+static void handle_monster_killed(GameState *state, Level *level, int m)
+{
+    MonsterList *monsters = &level->monsters;
+
+    // Drop the monster's loot where it died
+    LootTable *loot_table = monster_archetype(monsters->cold[m].archetype)->loot_table;
+    LootList drops = generate_loot_drops((Vector2){monsters->x[m], monsters->y[m]}, loot_table, &state->player.inventory);
+    for (int l = 0; l < drops.count; l++)
+    {
+        loot_list_add(&level->loot, drops.loot[l]);
+    }
+    loot_list_cleanup(&drops);
+
+    // Track defeated monsters for goal
+    if (level->goal.type == GOAL_TYPE_MONSTERS)
+    {
+        level->goal.monsters_defeated++;
+    }
+}
+
+static void handle_loot_collected(GameState *state, Loot *loot)
+{
+    // Player picked up loot - add to inventory
+    inventory_add_loot(&state->player.inventory, loot->type, loot->value);
+
+    // Handle special case for fireballs - also add to projectile inventory
+    if (loot->type == LOOT_FIREBALL)
+    {
+        state->player.projectile_inventory += loot->value;
+        cap_fireballs(&state->player);
+    }
+    loot->active = false;
+}
+
+static void handle_pickup_collected(GameState *state, Pickup *pickup)
+{
+    // Player picked up fireball
+    if (pickup->type == PICKUP_FIREBALL)
+    {
+        state->player.inventory.counts[LOOT_FIREBALL] += pickup->value;
+        state->player.projectile_inventory += pickup->value;
+        cap_fireballs(&state->player);
+    }
+    pickup->active = false;
+}
+
+// Apply the events of this tick in the order they were found, then empty the queue
+static void drain_events(GameState *state, Level *level)
+{
+    for (int i = 0; i < state->events.count; i++)
+    {
+        const GameEvent *event = &state->events.events[i];
+        switch (event->type)
+        {
+        case GAME_EVENT_MONSTER_KILLED:
+            handle_monster_killed(state, level, event->index);
+            break;
+        case GAME_EVENT_PLAYER_HIT:
+            handle_player_hit(state, &event->hit);
+            break;
+        case GAME_EVENT_LOOT_COLLECTED:
+            handle_loot_collected(state, &level->loot.loot[event->index]);
+            break;
+        case GAME_EVENT_PICKUP_COLLECTED:
+            handle_pickup_collected(state, &level->pickups.pickups[event->index]);
+            break;
+        case GAME_EVENT_PROJECTILE_EXPIRED:
+            state->projectiles.projectiles[event->index].active = false; // Removed by the next projectile update
+            break;
+        }
+    }
+    game_event_queue_clear(&state->events);
+}
+
+void game_sim_init(GameState *state, int contact_threads)
+{
+    state->timers = timer_wheel_create(16);
+    state->world_timers = timer_wheel_create(64);
+    state->burnt_message_timer = TIMER_HANDLE_NONE;
+    state->is_paused = false;
+    state->hazard_cooldown = TIMER_HANDLE_NONE;
+    state->sword_attack_cooldown = TIMER_HANDLE_NONE;
+    state->game_over = false;
+    state->last_collision_type = COLLISION_TYPE_NONE;
+    state->projectiles = projectile_list_create(100); // Initial capacity; grows as needed
+    projectile_archetypes_load();
+    state->bodies = body_batch_create(256);
+    state->broadphase = broadphase_create(256);
+    state->events = game_event_queue_create(32);
+    state->contacts = contact_pipeline_create(contact_threads);
+    state->in_level_transition = false;
+    state->next_level_index = 0;
+    state->game_victory = false;
+    state->victory_timer = 0.0f;
+    state->elapsed_time = 0.0f;
+    state->current_screen = GAME_SCREEN_TITLE;
+
+    // Initialize levels
+    monster_archetypes_load();
+    initialize_levels(state);
+
+    // Initialize loot system
+    init_loot_system(state);
+    monster_archetypes_bind_loot(&state->loot_system);
+
+    // Initialize player at the first level's start
+    Level *current_level = &state->levels[state->current_level_index];
+    state->player = player_create(current_level->player_start_position.x, current_level->player_start_position.y);
+}
+
+void game_sim_start_level(GameState *state, int level_index)
+{
+    state->current_screen = GAME_SCREEN_PLAYING;
+    state->current_level_index = level_index;
+    state->game_over = false;
+    state->game_victory = false;
+    state->elapsed_time = 0.0f;
+    state->is_paused = false;
+    timer_wheel_clear(&state->timers); // Drop cooldowns and a hit pause left over from the last run
+
+    // Reset player and level
+    Level *level = &state->levels[level_index];
+    state->player.position = level->player_start_position;
+    state->player.velocity = (Vector2){0, 0};
+    state->player.previous_position = state->player.position;
+    state->player.hearts = state->player.max_hearts;
+    state->player.is_dead = false;
+    player_clear_damage_type(&state->player, &state->world_timers);
+    state->player.projectile_inventory = 0;
+
+    broadphase_clear(&state->broadphase);
+
+    // Reactivate all enemies in all levels
+    for (int i = 0; i < state->level_count; i++)
+    {
+        level_reactivate_enemies(&state->levels[i]);
+        level_reset(&state->levels[i], &state->world_timers);
+    }
+}
+
+void game_sim_advance_level(GameState *state)
+{
+    // Transition to next level
+    state->current_level_index = state->next_level_index;
+    state->in_level_transition = false;
+    state->is_paused = false;
+
+    Level *next_level = &state->levels[state->current_level_index];
+    broadphase_clear(&state->broadphase);
+
+    // Reset player position to new level's start
+    state->player.position = next_level->player_start_position;
+    state->player.velocity = (Vector2){0, 0};
+    state->player.previous_position = state->player.position;
+    state->player.hearts = state->player.max_hearts; // Full health for new level
+    state->player.is_dead = false;                    // Reset dead flag so damage can be taken
+    player_clear_damage_type(&state->player, &state->world_timers); // Reset any active damage effects
+    level_reset(next_level, &state->world_timers);
+}
+
+bool game_sim_is_active(const GameState *state)
+{
+    // Menus and the level transition screen freeze the simulation
+    return !state->options_menu_active && state->current_screen != GAME_SCREEN_TITLE && !state->in_level_transition;
+}
+
+// ============ COLLISIONS ============
+
+// Pickup and loot hitboxes: the scaled sprite, centered on the position
+static Rectangle pickup_rect(const Pickup *pickup)
+{
+    return (Rectangle){
+        pickup->position.x - (pickup->width * pickup->scale) / 2.0f,
+        pickup->position.y - (pickup->height * pickup->scale) / 2.0f,
+        pickup->width * pickup->scale,
+        pickup->height * pickup->scale};
+}
+
+static Rectangle loot_rect(const Loot *loot)
+{
+    Rectangle loot_source = texture_cache_get_sprite(loot->texture).source;
+    return (Rectangle){
+        loot->position.x - (loot_source.width * loot->scale) / 2.0f,
+        loot->position.y - (loot_source.height * loot->scale) / 2.0f,
+        loot_source.width * loot->scale,
+        loot_source.height * loot->scale};
+}
+
+// Mirror everything collidable into the broadphase and find the overlapping pairs.
+// The boxes cover what the collision checks below test (whole paths for swept movers, and
+// for hazards everywhere they can have got to since they were last evaluated), so no hit is
+// lost. Hazards, pickups and loot only ever hit the player, who is always awake, so the ones
+// in sleeping sectors stay out. Monsters stay in: a fireball can fly into a sleeping sector.
+static void find_collision_pairs(GameState *state, Level *level, const SectorWindow *awake, Rectangle player_from, Rectangle player_rect)
+{
+    Broadphase *broadphase = &state->broadphase;
+
+    broadphase_set(broadphase, BROADPHASE_PLAYER, 0, collision_sweep_bounds(player_from, player_rect), COLLISION_LAYER_PLAYER,
+                   COLLISION_LAYER_HAZARD | COLLISION_LAYER_MONSTER | COLLISION_LAYER_MONSTER_SHOT |
+                       COLLISION_LAYER_PICKUP | COLLISION_LAYER_LOOT);
+    if (state->player.is_using_sword)
+        broadphase_set(broadphase, BROADPHASE_PLAYER, 1, state->player.sword_hitbox, COLLISION_LAYER_SWORD, COLLISION_LAYER_MONSTER);
+    else
+        broadphase_disable(broadphase, BROADPHASE_PLAYER, 1);
+
+    for (int i = 0; i < level->hazards.count; i++)
+    {
+        Hazard *hazard = &level->hazards.hazards[i];
+        if (!hazard->active)
+        {
+            broadphase_disable(broadphase, BROADPHASE_HAZARD, i);
+            continue;
+        }
+
+        Rectangle reach = hazard_reach(hazard, level_time(level));
+        if (sector_window_overlaps(awake, reach.x, reach.x + reach.width))
+        {
+            broadphase_set(broadphase, BROADPHASE_HAZARD, i, reach, COLLISION_LAYER_HAZARD, 0);
+        }
+        else
+        {
+            broadphase_disable(broadphase, BROADPHASE_HAZARD, i);
+            state->sector_stats.hazards_skipped++;
+        }
+    }
+    broadphase_truncate(broadphase, BROADPHASE_HAZARD, level->hazards.count);
+
+    for (int i = 0; i < level->monsters.count; i++)
+    {
+        if (level->monsters.active[i])
+            broadphase_set(broadphase, BROADPHASE_MONSTER, i, monster_list_rect(&level->monsters, i), COLLISION_LAYER_MONSTER, 0);
+        else
+            broadphase_disable(broadphase, BROADPHASE_MONSTER, i);
+    }
+    broadphase_truncate(broadphase, BROADPHASE_MONSTER, level->monsters.count);
+
+    for (int i = 0; i < state->projectiles.count; i++)
+    {
+        Projectile *projectile = &state->projectiles.projectiles[i];
+        Rectangle projectile_rect = projectile_swept_bounds(projectile);
+        if (!projectile->active)
+            broadphase_disable(broadphase, BROADPHASE_PROJECTILE, i);
+        else if (projectile->source == PROJECTILE_SOURCE_PLAYER)
+            broadphase_set(broadphase, BROADPHASE_PROJECTILE, i, projectile_rect, COLLISION_LAYER_PLAYER_SHOT, COLLISION_LAYER_MONSTER);
+        else
+            broadphase_set(broadphase, BROADPHASE_PROJECTILE, i, projectile_rect, COLLISION_LAYER_MONSTER_SHOT, 0);
+    }
+    broadphase_truncate(broadphase, BROADPHASE_PROJECTILE, state->projectiles.count);
+
+    for (int i = 0; i < level->pickups.count; i++)
+    {
+        Pickup *pickup = &level->pickups.pickups[i];
+        if (pickup->active && sector_window_contains(awake, pickup->position.x))
+            broadphase_set(broadphase, BROADPHASE_PICKUP, i, pickup_rect(pickup), COLLISION_LAYER_PICKUP, 0);
+        else
+            broadphase_disable(broadphase, BROADPHASE_PICKUP, i);
+    }
+    broadphase_truncate(broadphase, BROADPHASE_PICKUP, level->pickups.count);
+
+    for (int i = 0; i < level->loot.count; i++)
+    {
+        Loot *loot = &level->loot.loot[i];
+        if (loot->active && sector_window_contains(awake, loot->position.x))
+            broadphase_set(broadphase, BROADPHASE_LOOT, i, loot_rect(loot), COLLISION_LAYER_LOOT, 0);
+        else
+            broadphase_disable(broadphase, BROADPHASE_LOOT, i);
+    }
+    broadphase_truncate(broadphase, BROADPHASE_LOOT, level->loot.count);
+
+    broadphase_find_pairs(broadphase);
+}
+
+// Hand this tick's broadphase hits to the contact pipeline, one category at a time.
+// Hazards and monsters (sword included) are skipped while the hazard cooldown runs.
+static void gather_candidates(GameState *state, Level *level, double level_clock)
+{
+    Broadphase *broadphase = &state->broadphase;
+    ContactPipeline *contacts = &state->contacts;
+    contact_pipeline_begin(contacts);
+
+    if (!timer_wheel_pending(&state->timers, state->hazard_cooldown))
+    {
+        int hazard_hits = broadphase_collect(broadphase, BROADPHASE_HAZARD, COLLISION_LAYER_HAZARD,
+                                             BROADPHASE_PLAYER, COLLISION_LAYER_PLAYER, true);
+        contact_pipeline_add_candidates(contacts, CONTACT_PLAYER_HAZARD, broadphase->hits, hazard_hits);
+        for (int h = 0; h < hazard_hits; h++)
+        {
+            // Hazards are functions of the level clock, evaluated here for the candidates only
+            // (the rest stay unevaluated), so the narrow phase just reads them
+            hazard_update(&level->hazards.hazards[broadphase->hits[h].first], level_clock);
+        }
+        int sword_hits = broadphase_collect(broadphase, BROADPHASE_MONSTER, COLLISION_LAYER_MONSTER,
+                                            BROADPHASE_PLAYER, COLLISION_LAYER_SWORD, true);
+        contact_pipeline_add_candidates(contacts, CONTACT_SWORD_MONSTER, broadphase->hits, sword_hits);
+        int monster_hits = broadphase_collect(broadphase, BROADPHASE_MONSTER, COLLISION_LAYER_MONSTER,
+                                              BROADPHASE_PLAYER, COLLISION_LAYER_PLAYER, true);
+        contact_pipeline_add_candidates(contacts, CONTACT_PLAYER_MONSTER, broadphase->hits, monster_hits);
+    }
+
+    int pickup_hits = broadphase_collect(broadphase, BROADPHASE_PICKUP, COLLISION_LAYER_PICKUP,
+                                         BROADPHASE_PLAYER, COLLISION_LAYER_PLAYER, true);
+    contact_pipeline_add_candidates(contacts, CONTACT_PLAYER_PICKUP, broadphase->hits, pickup_hits);
+    int loot_hits = broadphase_collect(broadphase, BROADPHASE_LOOT, COLLISION_LAYER_LOOT,
+                                       BROADPHASE_PLAYER, COLLISION_LAYER_PLAYER, true);
+    contact_pipeline_add_candidates(contacts, CONTACT_PLAYER_LOOT, broadphase->hits, loot_hits);
+    int shot_hits = broadphase_collect(broadphase, BROADPHASE_PROJECTILE, COLLISION_LAYER_PLAYER_SHOT,
+                                       BROADPHASE_MONSTER, COLLISION_LAYER_MONSTER, false);
+    contact_pipeline_add_candidates(contacts, CONTACT_PROJECTILE_MONSTER, broadphase->hits, shot_hits);
+    int incoming_hits = broadphase_collect(broadphase, BROADPHASE_PROJECTILE, COLLISION_LAYER_MONSTER_SHOT,
+                                           BROADPHASE_PLAYER, COLLISION_LAYER_PLAYER, true);
+    contact_pipeline_add_candidates(contacts, CONTACT_PROJECTILE_PLAYER, broadphase->hits, incoming_hits);
+}
+
+// What the narrow phase tests against
+typedef struct
+{
+    const GameState *state;
+    const Level *level;
+    Rectangle player_from; // The player's path this step
+    Rectangle player_rect;
+} CollisionWorld;
+
+// Narrow phase for one candidate. Runs on the contact threads, so it only reads.
+static bool test_contact(void *context, ContactCategory category, BroadphaseHit candidate, float *time_of_impact)
+{
+    const CollisionWorld *world = (const CollisionWorld *)context;
+    const Level *level = world->level;
+    const MonsterList *monsters = &level->monsters;
+
+    switch (category)
+    {
+    case CONTACT_PLAYER_HAZARD:
+    {
+        const Hazard *hazard = &level->hazards.hazards[candidate.first];
+        return hazard->active && hazard_check_swept_collision(hazard, world->player_from, world->player_rect) &&
+               hazard_is_dangerous(hazard); // Only if it's dangerous/not faded out
+    }
+    case CONTACT_SWORD_MONSTER:
+        return monsters->active[candidate.first] &&
+               CheckCollisionRecs(world->state->player.sword_hitbox, monster_list_rect(monsters, candidate.first));
+    case CONTACT_PLAYER_MONSTER:
+        return monsters->active[candidate.first] &&
+               CheckCollisionRecs(world->player_rect, monster_list_rect(monsters, candidate.first));
+    case CONTACT_PLAYER_PICKUP:
+    {
+        const Pickup *pickup = &level->pickups.pickups[candidate.first];
+        return pickup->active && CheckCollisionRecs(world->player_rect, pickup_rect(pickup));
+    }
+    case CONTACT_PLAYER_LOOT:
+    {
+        const Loot *loot = &level->loot.loot[candidate.first];
+        return loot->active && CheckCollisionRecs(world->player_rect, loot_rect(loot));
+    }
+    case CONTACT_PROJECTILE_MONSTER:
+    {
+        // The projectile's whole path this step is tested
+        const Projectile *projectile = &world->state->projectiles.projectiles[candidate.first];
+        if (!projectile->active || projectile->source != PROJECTILE_SOURCE_PLAYER || !monsters->active[candidate.second])
+            return false;
+        Rectangle monster_rect = monster_list_rect(monsters, candidate.second);
+        return projectile_check_swept_collision(projectile, monster_rect, monster_rect, time_of_impact);
+    }
+    case CONTACT_PROJECTILE_PLAYER:
+        return projectile_check_player_collision(&world->state->projectiles.projectiles[candidate.first],
+                                                 world->player_from, world->player_rect);
+    default:
+        return false;
+    }
+}
+
+// Walk the contacts in order and push what they mean onto the event queue. This is where
+// contacts depend on each other: a swing of the sword hits one monster, a monster the sword
+// killed no longer touches the player, and a fireball hits the first monster on its path
+// that is still alive. Every sword contact comes before every player-monster contact, and
+// handle_player_hit takes only the first contact hit of the tick (tests/test_game_sim.c).
+static void resolve_contacts(GameState *state, Level *level)
+{
+    const ContactPipeline *pipeline = &state->contacts;
+    GameEventQueue *events = &state->events;
+    MonsterList *monsters = &level->monsters;
+
+    for (int c = 0; c < pipeline->count; c++)
+    {
+        const Contact *contact = &pipeline->contacts[c];
+        int m = contact->first;
+        switch (contact->category)
+        {
+        case CONTACT_PLAYER_HAZARD:
+            game_event_push_player_hit(events, hazard_hit(&level->hazards.hazards[contact->first]));
+            break;
+        case CONTACT_SWORD_MONSTER:
+            if (!timer_wheel_pending(&state->timers, state->sword_attack_cooldown) && monsters->active[m])
+            {
+                // Player hit monster with sword. The damage lands at once, so a monster
+                // killed here neither touches the player nor takes a fireball below.
+                monster_list_take_damage(monsters, m, 1); // Sword deals 1 damage
+                timer_wheel_restart(&state->timers, &state->sword_attack_cooldown, timer_ticks(1.0f), NULL, NULL, 0); // Set cooldown after attack
+                if (!monsters->active[m])
+                {
+                    game_event_push(events, GAME_EVENT_MONSTER_KILLED, m);
+                }
+            }
+            break;
+        case CONTACT_PLAYER_MONSTER:
+            if (monsters->active[m])
+            {
+                // Player hit a monster
+                PlayerHit hit = {1, DAMAGE_TYPE_MONSTER_HIT, DAMAGE_DISPLAY_MONSTER_HIT, COLLISION_TYPE_MONSTER, true}; // Monsters deal 1 damage
+                game_event_push_player_hit(events, hit);
+            }
+            break;
+        case CONTACT_PLAYER_PICKUP:
+            game_event_push(events, GAME_EVENT_PICKUP_COLLECTED, contact->first);
+            break;
+        case CONTACT_PLAYER_LOOT:
+            game_event_push(events, GAME_EVENT_LOOT_COLLECTED, contact->first);
+            break;
+        case CONTACT_PROJECTILE_MONSTER:
+        {
+            // Contacts come grouped by projectile, and only the monster it reaches first is
+            // hit, since the projectile is destroyed on impact
+            int p = contact->first;
+            m = -1;
+            float earliest_impact = 0.0f;
+            for (; c < pipeline->count && pipeline->contacts[c].category == CONTACT_PROJECTILE_MONSTER &&
+                   pipeline->contacts[c].first == p;
+                 c++)
+            {
+                const Contact *candidate = &pipeline->contacts[c];
+                if (monsters->active[candidate->second] && (m < 0 || candidate->time_of_impact < earliest_impact))
+                {
+                    m = candidate->second;
+                    earliest_impact = candidate->time_of_impact;
+                }
+            }
+            c--; // The loop stepped past the group
+
+            if (m >= 0)
+            {
+                monster_list_take_damage(monsters, m, 1); // Each projectile deals 1 damage
+                game_event_push(events, GAME_EVENT_PROJECTILE_EXPIRED, p);
+                if (!monsters->active[m])
+                {
+                    game_event_push(events, GAME_EVENT_MONSTER_KILLED, m);
+                }
+            }
+            break;
+        }
+        case CONTACT_PROJECTILE_PLAYER:
+        {
+            // Monster projectile hit player (projectiles are fire-based and deal 1 damage)
+            PlayerHit hit = {1, DAMAGE_TYPE_FIRE, DAMAGE_DISPLAY_FIRE, COLLISION_TYPE_HAZARD, false};
+            game_event_push_player_hit(events, hit);
+            game_event_push(events, GAME_EVENT_PROJECTILE_EXPIRED, contact->first);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+// Charge the time since the previous mark to a phase. Free when no timing sink is attached.
+static unsigned long long mark_phase(GameState *state, StepPhase phase, unsigned long long since)
+{
+    if (!state->step_timings)
+        return 0;
+
+    unsigned long long now = sim_clock_ns();
+    state->step_timings->ns[phase] += now - since;
+    return now;
+}
+
+void game_step(GameState *state, const PlayerInput *input, float delta_time)
+{
+    if (!game_sim_is_active(state))
+    {
+        return;
+    }
+
+    state->delta_time = delta_time;
+
+    // Increment elapsed time (always, even when paused, to track total play time)
+    if (!state->game_over && !state->game_victory)
+    {
+        state->elapsed_time += delta_time;
+    }
+
+    Level *current_level = &state->levels[state->current_level_index];
+    unsigned long long mark = state->step_timings ? sim_clock_ns() : 0;
+
+    // Everything that pauses is decided here: the pause menu stops the game timers and the
+    // world; a hit pause stops only the world (and the world timers)
+    bool timers_running = !state->pause_menu_active;
+    bool world_running = timers_running && !state->is_paused;
+
+    // Only the sectors around the camera (which follows the player) are simulated this tick
+    SectorWindow awake = sector_window(state->player.position.x, SIM_SECTOR_RADIUS);
+    state->sector_stats = (SectorStats){0};
+    state->sector_stats.active_sectors = sector_window_count(&awake);
+
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_HAZARDS);
+    // Advance the level clock. Hazards are functions of it and are only evaluated when they
+    // are collision candidates (below) or drawn.
+    if (world_running)
+    {
+        current_level->clock++;
+    }
+    double level_clock = level_time(current_level);
+    PROFILE_ZONE_END(PROFILE_ZONE_HAZARDS);
+    mark = mark_phase(state, STEP_PHASE_HAZARDS, mark);
+
+    // Update game objects
+    if (world_running)
+    {
+        // Fire the world timers that are due (damage effects, potions, dragon and spawner cooldowns)
+        timer_wheel_advance(&state->world_timers);
+
+        PROFILE_ZONE_BEGIN(PROFILE_ZONE_PLAYER);
+        state->player.previous_position = state->player.position;
+        player_handle_input(&state->player, input, &state->world_timers);
+        player_update_with_hazards(&state->player, &current_level->hazards, delta_time);
+        player_update_sword_hitbox(&state->player);
+        PROFILE_ZONE_END(PROFILE_ZONE_PLAYER);
+        mark = mark_phase(state, STEP_PHASE_PLAYER, mark);
+
+        // Update all monsters. The camera follows the player horizontally (background_update),
+        // so monsters think at a rate set by their distance from the player.
+        PROFILE_ZONE_BEGIN(PROFILE_ZONE_MONSTERS);
+        monster_list_update(&current_level->monsters, state->player.position.x, level_clock, delta_time);
+        state->sector_stats.monsters_skipped = current_level->monsters.count - current_level->monsters.thinking;
+        PROFILE_ZONE_END(PROFILE_ZONE_MONSTERS);
+
+        // Per-kind monster behavior - dragons fire at the player
+        PROFILE_ZONE_BEGIN(PROFILE_ZONE_DRAGON_AI);
+        monster_list_update_behaviors(&current_level->monsters, &state->projectiles, state->player.position, &state->world_timers);
+        PROFILE_ZONE_END(PROFILE_ZONE_DRAGON_AI);
+        mark = mark_phase(state, STEP_PHASE_MONSTERS, mark);
+
+        // Fire a fireball from the player towards the aim point
+        PROFILE_ZONE_BEGIN(PROFILE_ZONE_PROJECTILES);
+        if (input->fire && state->player.projectile_inventory > 0)
+        {
+            Projectile fireball = projectile_create_fireball(
+                (Vector2){state->player.position.x + state->player.width / 2.0f, state->player.position.y},
+                input->fire_target,
+                PROJECTILE_SOURCE_PLAYER);
+            projectile_list_add(&state->projectiles, fireball);
+            state->player.projectile_inventory--;            // Consume one projectile
+            state->player.inventory.counts[LOOT_FIREBALL]--; // Update inventory display
+        }
+
+        // Update all projectiles
+        projectile_list_update(&state->projectiles, &state->bodies, state->player.position.x, delta_time);
+        PROFILE_ZONE_END(PROFILE_ZONE_PROJECTILES);
+        mark = mark_phase(state, STEP_PHASE_PROJECTILES, mark);
+
+        // Update all pickups
+        PROFILE_ZONE_BEGIN(PROFILE_ZONE_PICKUPS);
+        state->sector_stats.pickups_skipped = pickup_list_update(&current_level->pickups, &state->bodies, &awake, state->player.position.x, delta_time);
+        pickup_list_recycle(&current_level->pickups, &current_level->spawners, &current_level->pickup_pool);
+
+        // Update all spawners in the level (spawn new pickups on a timer, reusing pooled ones)
+        state->sector_stats.spawners_skipped = pickup_spawner_list_update(&current_level->spawners, &current_level->pickups, &current_level->pickup_pool,
+                                                                          &state->world_timers, &awake);
+        mark = mark_phase(state, STEP_PHASE_PICKUPS, mark);
+
+        // Update loot items
+        state->sector_stats.loot_skipped = loot_list_update(&current_level->loot, &state->bodies, &awake, state->player.position.x, delta_time);
+        PROFILE_ZONE_END(PROFILE_ZONE_PICKUPS);
+        mark = mark_phase(state, STEP_PHASE_LOOT, mark);
+    }
+
+    // Collisions run in two phases. Detection tests every broadphase candidate without
+    // changing anything another candidate reads (on several threads when there are many);
+    // resolution then walks the contacts in a fixed order on this thread and pushes events,
+    // and drain_events applies them.
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_BROADPHASE);
+    Rectangle player_rect = {
+        state->player.position.x,
+        state->player.position.y,
+        state->player.width,
+        state->player.height};
+    Rectangle player_from = {
+        state->player.previous_position.x,
+        state->player.previous_position.y,
+        state->player.width,
+        state->player.height};
+
+    find_collision_pairs(state, current_level, &awake, player_from, player_rect);
+    gather_candidates(state, current_level, level_clock);
+    PROFILE_ZONE_END(PROFILE_ZONE_BROADPHASE);
+
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_NARROW_PHASE);
+    CollisionWorld world = {state, current_level, player_from, player_rect};
+    contact_pipeline_run(&state->contacts, test_contact, &world);
+    PROFILE_ZONE_END(PROFILE_ZONE_NARROW_PHASE);
+
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_RESOLVE);
+    resolve_contacts(state, current_level);
+    PROFILE_ZONE_END(PROFILE_ZONE_RESOLVE);
+
+    // Apply everything the checks found
+    PROFILE_ZONE_BEGIN(PROFILE_ZONE_EVENTS);
+    drain_events(state, current_level);
+    PROFILE_ZONE_END(PROFILE_ZONE_EVENTS);
+
+    mark = mark_phase(state, STEP_PHASE_COLLISIONS, mark);
+
+    // Count down the cooldowns and the hit pause (hit_pause_over resumes and respawns)
+    if (timers_running)
+    {
+        timer_wheel_advance(&state->timers);
+    }
+
+    // Update game over timer
+    if (state->game_over)
+    {
+        // When burnt message timer expires and game is over, return to title screen
+        if (!timer_wheel_pending(&state->timers, state->burnt_message_timer))
+        {
+            // Return to title screen
+            state->current_screen = GAME_SCREEN_TITLE;
+            state->game_over = false;
+            state->selected_menu_item = 1; // Default to "Start Game"
+            state->selected_level = 0;     // Reset to level 1
+            timer_wheel_cancel(&state->timers, state->hazard_cooldown);
+            state->player.hearts = state->player.max_hearts;
+            state->player.is_dead = false;
+            player_clear_damage_type(&state->player, &state->world_timers);
+            state->player.projectile_inventory = 0;
+
+            // Reactivate all enemies for next playthrough
+            for (int i = 0; i < state->level_count; i++)
+            {
+                level_reactivate_enemies(&state->levels[i]);
+                level_reset(&state->levels[i], &state->world_timers);
+            }
+        }
+    }
+
+    // Check if level goal is reached
+    if (level_check_goal_reached(current_level, state->player.position))
+    {
+        // Move to next level
+        if (state->current_level_index < state->level_count - 1)
+        {
+            // Start level transition screen
+            state->in_level_transition = true;
+            state->next_level_index = state->current_level_index + 1;
+            state->is_paused = true; // Pause game during transition
+        }
+        else
+        {
+            // Game complete - show victory screen
+            state->game_victory = true;
+            state->victory_timer = 0.0f;
+            state->is_paused = true;
+        }
+    }
+
+    // Advance victory animation
+    if (state->game_victory)
+    {
+        state->victory_timer += delta_time;
+    }
+    mark_phase(state, STEP_PHASE_RULES, mark);
+}
+
+void game_sim_cleanup(GameState *state)
+{
+    player_cleanup(&state->player);
+    broadphase_cleanup(&state->broadphase);
+    game_event_queue_cleanup(&state->events);
+    contact_pipeline_cleanup(&state->contacts);
+
+    // Cleanup all levels
+    for (int i = 0; i < state->level_count; i++)
+    {
+        level_cleanup(&state->levels[i]);
+    }
+
+    projectile_list_cleanup(&state->projectiles);
+    projectile_archetypes_unload();
+    monster_archetypes_unload();
+    body_batch_cleanup(&state->bodies);
+    loot_system_cleanup(&state->loot_system);
+    timer_wheel_cleanup(&state->timers);
+    timer_wheel_cleanup(&state->world_timers);
+}
@@ -1,63 +1,28 @@
 #include "hazard.h"
-#include "asset_paths.h"
+#include "collision.h"
+#include "config.h"
+#include "periodic.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
-HazardList hazard_list_create(int capacity)
+static void hazard_prepare(Hazard *hazard)
 {
-    HazardList list;
-    list.capacity = capacity;
-    list.count = 0;
-    list.hazards = (Hazard *)malloc(sizeof(Hazard) * capacity);
-    return list;
-}
-
-void hazard_list_cleanup(HazardList *list)
-{
-    // Note: Textures are cached statically and managed globally, not per-list
-    // So we don't unload them here to avoid double-unload issues
-
-    if (list->hazards != NULL)
-    {
-        free(list->hazards);
-        list->hazards = NULL;
-    }
-    list->count = 0;
-    list->capacity = 0;
-}
-
-void hazard_list_add(HazardList *list, Hazard hazard)
-{
-    // Cache textures by type to avoid loading the same texture multiple times
-    static Texture2D dust_storm_texture = {0};
-    static Texture2D lava_jet_texture = {0};
-    static Texture2D wind_daggers_texture = {0};
+    hazard->previous_bounds = hazard->bounds;
 
-    if (hazard.texture.id == 0)
+    // Textures come from the shared cache, so each asset is loaded only once across all levels
+    if (hazard->texture == TEXTURE_HANDLE_INVALID)
     {
-        switch (hazard.type)
+        switch (hazard->type)
         {
         case HAZARD_DUST_STORM:
-            if (dust_storm_texture.id == 0)
-            {
-                dust_storm_texture = LoadTexture(get_asset_path("dust_tornado.png"));
-            }
-            hazard.texture = dust_storm_texture;
+            hazard->texture = texture_cache_acquire("dust_tornado.png");
             break;
         case HAZARD_LAVA_JET:
-            if (lava_jet_texture.id == 0)
-            {
-                lava_jet_texture = LoadTexture(get_asset_path("lava_jet.png"));
-            }
-            hazard.texture = lava_jet_texture;
+            hazard->texture = texture_cache_acquire("lava_jet.png");
             break;
         case HAZARD_WIND_DAGGERS:
-            if (wind_daggers_texture.id == 0)
-            {
-                wind_daggers_texture = LoadTexture(get_asset_path("wind_daggers.png"));
-            }
-            hazard.texture = wind_daggers_texture;
+            hazard->texture = texture_cache_acquire("wind_daggers.png");
             break;
         case HAZARD_LAVA_PIT:
         case HAZARD_SPIKE_TRAP:
@@ -67,87 +32,85 @@ void hazard_list_add(HazardList *list, Hazard hazard)
         }
     }
 
-    if (list->count < list->capacity)
-    {
-        // Store the initial bounds for later reset
-        hazard.initial_bounds = hazard.bounds;
-        list->hazards[list->count++] = hazard;
-    }
+    // Store the initial bounds and velocity; the patrol is worked out from them
+    hazard->initial_bounds = hazard->bounds;
+    hazard->initial_velocity = hazard->velocity;
+    hazard->evaluated_time = 0.0;
 }
 
-void hazard_update(Hazard *hazard)
+// Each hazard holds a reference into the shared texture cache
+static void hazard_release(Hazard *hazard)
 {
-    if (!hazard->active)
-        return;
+    texture_cache_release(hazard->texture);
+}
+
+SLOT_MAP_DEFINE(HazardList, Hazard, hazards, hazard_list, hazard_prepare, hazard_release)
 
-    // Update movement
+static PatrolPath hazard_patrol(const Hazard *hazard)
+{
+    return (PatrolPath){hazard->initial_bounds.x, hazard->initial_velocity.x,
+                        hazard->patrol_left_bound, hazard->patrol_right_bound, hazard->patrol_speed};
+}
+
+// Bounds at time; the horizontal velocity there goes to *velocity unless it is NULL
+static Rectangle hazard_bounds_at(const Hazard *hazard, double time, float *velocity)
+{
+    Rectangle bounds = hazard->initial_bounds;
     if (hazard->can_move)
     {
-        // Update position based on velocity (similar to monster patrol logic)
-        hazard->bounds.x += hazard->velocity.x * GetFrameTime();
-
-        // Patrol logic - bounce back and forth at boundaries
-        if (hazard->bounds.x <= hazard->patrol_left_bound)
-        {
-            hazard->bounds.x = hazard->patrol_left_bound;
-            hazard->velocity.x = hazard->patrol_speed; // Move right
-        }
-        else if (hazard->bounds.x >= hazard->patrol_right_bound)
-        {
-            hazard->bounds.x = hazard->patrol_right_bound;
-            hazard->velocity.x = -hazard->patrol_speed; // Move left
-        }
+        PatrolPath patrol = hazard_patrol(hazard);
+        bounds.x = patrol_path_x(&patrol, time, velocity);
     }
+    return bounds;
+}
 
-    // Update fading
-    if (hazard->can_fade)
-    {
-        hazard->fade_timer += GetFrameTime();
+// Opacity at time (fully visible when the hazard does not fade)
+static float hazard_opacity_at(const Hazard *hazard, double time, bool *faded_out)
+{
+    *faded_out = false;
+    if (!hazard->can_fade)
+        return 1.0f;
 
-        float total_cycle_time = hazard->fade_opaque_duration + hazard->fade_out_duration + hazard->fade_out_interval + hazard->fade_in_duration;
+    FadeCycle cycle = {hazard->fade_opaque_duration, hazard->fade_out_duration,
+                       hazard->fade_out_interval, hazard->fade_in_duration};
+    return fade_cycle_opacity(&cycle, time, faded_out);
+}
 
-        // Wrap timer to cycle
-        if (hazard->fade_timer >= total_cycle_time)
-        {
-            hazard->fade_timer -= total_cycle_time;
-        }
+static void hazard_evaluate(Hazard *hazard, double time)
+{
+    double previous_time = time > SIMULATION_DT ? time - SIMULATION_DT : 0.0;
+    hazard->previous_bounds = hazard_bounds_at(hazard, previous_time, NULL);
+    hazard->bounds = hazard_bounds_at(hazard, time, &hazard->velocity.x);
+    hazard->current_opacity = hazard_opacity_at(hazard, time, &hazard->is_faded_out);
+    hazard->evaluated_time = time;
+}
 
-        // Determine current phase and opacity
-        float current_time = hazard->fade_timer;
+void hazard_update(Hazard *hazard, double time)
+{
+    if (!hazard->active)
+        return;
 
-        if (current_time < hazard->fade_opaque_duration)
-        {
-            // Fully opaque phase
-            hazard->is_faded_out = false;
-            hazard->current_opacity = 1.0f;
-        }
-        else if (hazard->fade_out_duration > 0.0f && current_time < hazard->fade_opaque_duration + hazard->fade_out_duration)
-        {
-            // Fading out phase
-            hazard->is_faded_out = true;
-            float fade_out_time = current_time - hazard->fade_opaque_duration;
-            hazard->current_opacity = 1.0f - (fade_out_time / hazard->fade_out_duration);
-        }
-        else if (current_time < hazard->fade_opaque_duration + hazard->fade_out_duration + hazard->fade_out_interval)
-        {
-            // Fully faded out phase (or instant fade out if fade_out_duration is 0)
-            hazard->is_faded_out = true;
-            hazard->current_opacity = 0.0f;
-        }
-        else if (hazard->fade_in_duration > 0.0f && current_time < hazard->fade_opaque_duration + hazard->fade_out_duration + hazard->fade_out_interval + hazard->fade_in_duration)
-        {
-            // Fading in phase
-            hazard->is_faded_out = false;
-            float fade_in_time = current_time - (hazard->fade_opaque_duration + hazard->fade_out_duration + hazard->fade_out_interval);
-            hazard->current_opacity = fade_in_time / hazard->fade_in_duration;
-        }
-        else
-        {
-            // After fading in completes (or instant fade in if fade_in_duration is 0)
-            hazard->is_faded_out = false;
-            hazard->current_opacity = 1.0f;
-        }
-    }
+    hazard_evaluate(hazard, time);
+}
+
+Rectangle hazard_reach(const Hazard *hazard, double time)
+{
+    if (!hazard->can_move)
+        return hazard->bounds;
+
+    // Since the tick before the last evaluation the hazard has moved at most its top speed
+    // for that long (one more tick covers a bounce inside a tick)
+    float top_speed = fmaxf(fabsf(hazard->initial_velocity.x), hazard->patrol_speed);
+    float drift = top_speed * (float)(time - hazard->evaluated_time + SIMULATION_DT);
+    Rectangle swept = collision_sweep_bounds(hazard->previous_bounds, hazard->bounds);
+    float min_x = swept.x - drift;
+    float max_x = swept.x + swept.width + drift;
+
+    // It never leaves its patrol (or its start, which may lie outside the patrol)
+    min_x = fmaxf(min_x, fminf(hazard->patrol_left_bound, hazard->initial_bounds.x));
+    max_x = fminf(max_x, fmaxf(hazard->patrol_right_bound, hazard->initial_bounds.x) + hazard->bounds.width);
+
+    return (Rectangle){min_x, swept.y, max_x - min_x, swept.height};
 }
 
 void hazard_init_movement(Hazard *hazard, float left_bound, float right_bound, float speed)
@@ -179,6 +142,7 @@ void hazard_init_movement(Hazard *hazard, float left_bound, float right_bound, f
         hazard->velocity = (Vector2){speed, 0};
         break;
     }
+    hazard->initial_velocity = hazard->velocity;
 }
 
 void hazard_init_fade(Hazard *hazard, float fade_opaque_duration, float fade_out_duration, float fade_out_interval, float fade_in_duration)
@@ -188,27 +152,17 @@ void hazard_init_fade(Hazard *hazard, float fade_opaque_duration, float fade_out
     hazard->fade_out_duration = fade_out_duration;
     hazard->fade_out_interval = fade_out_interval;
     hazard->fade_in_duration = fade_in_duration;
-    hazard->fade_timer = 0.0f;
     hazard->current_opacity = 1.0f;
     hazard->is_faded_out = false;
 }
 
 void hazard_reset(Hazard *hazard)
 {
-    // Reset position to initial position
-    hazard->bounds = hazard->initial_bounds;
-    // Reset velocity based on patrol speed and direction
-    if (hazard->can_move)
-    {
-        hazard->velocity = (Vector2){hazard->patrol_speed, 0};
-    }
-    // Reset fade timer to restart the cycle
-    hazard->fade_timer = 0.0f;
-    hazard->current_opacity = 1.0f;
-    hazard->is_faded_out = false;
+    // Position, velocity and fade all follow from the time, so resetting is evaluating at 0
+    hazard_evaluate(hazard, 0.0);
 }
 
-bool hazard_is_dangerous(Hazard *hazard)
+bool hazard_is_dangerous(const Hazard *hazard)
 {
     // Hazard is dangerous if it's not faded out
     if (hazard->can_fade)
@@ -218,19 +172,42 @@ bool hazard_is_dangerous(Hazard *hazard)
     return true; // Non-fading hazards are always dangerous
 }
 
-bool hazard_check_collision(Hazard *hazard, Rectangle player_rect)
+bool hazard_check_collision(const Hazard *hazard, Rectangle player_rect)
 {
     return CheckCollisionRecs(hazard->bounds, player_rect);
 }
 
-void hazard_draw(Hazard *hazard, float camera_x)
+bool hazard_check_swept_collision(const Hazard *hazard, Rectangle player_from, Rectangle player_to)
+{
+    if (!hazard->can_move)
+        return hazard_check_collision(hazard, player_to);
+
+    float time_of_impact;
+    return collision_sweep(hazard->previous_bounds, hazard->bounds, player_from, player_to, &time_of_impact);
+}
+
+Rectangle hazard_swept_bounds(const Hazard *hazard)
+{
+    if (!hazard->can_move)
+        return hazard->bounds;
+    return collision_sweep_bounds(hazard->previous_bounds, hazard->bounds);
+}
+
+void hazard_draw(const Hazard *hazard, float camera_x, double time)
 {
     if (!hazard->active)
         return;
 
+    // Evaluated here rather than read back, so hazards that were not collision candidates
+    // this tick are still drawn where they are
+    bool faded_out;
+    Rectangle bounds = hazard_bounds_at(hazard, time, NULL);
+    float opacity = hazard_opacity_at(hazard, time, &faded_out);
+
     // Apply same camera offset as player drawing
-    Rectangle draw_rect = hazard->bounds;
-    draw_rect.x = hazard->bounds.x - camera_x + GetScreenWidth() / 2.0f;
+    Rectangle draw_rect = bounds;
+    draw_rect.x = bounds.x - camera_x + GetScreenWidth() / 2.0f;
+    Sprite sprite = texture_cache_get_sprite(hazard->texture);
 
     switch (hazard->type)
     {
@@ -266,34 +243,31 @@ void hazard_draw(Hazard *hazard, float camera_x)
     case HAZARD_DUST_STORM:
     {
         // Draw dust storm with opacity based on fade state
-        unsigned char alpha = (unsigned char)(hazard->current_opacity * 150.0f);
-        DrawTexturePro(hazard->texture,
-                       (Rectangle){0, 0, (float)hazard->texture.width, (float)hazard->texture.height},
-                       draw_rect,
-                       (Vector2){0, 0},
-                       0.0f,
-                       (Color){255, 255, 255, alpha});
+        unsigned char alpha = (unsigned char)(opacity * 150.0f);
+        sprite_draw_pro(sprite,
+                        draw_rect,
+                        (Vector2){0, 0},
+                        0.0f,
+                        (Color){255, 255, 255, alpha});
         break;
     }
     case HAZARD_LAVA_JET:
     {
-        unsigned char alpha = (unsigned char)(hazard->current_opacity * 150.0f);
-        DrawTexturePro(hazard->texture,
-                       (Rectangle){0, 0, (float)hazard->texture.width, (float)hazard->texture.height},
-                       draw_rect,
-                       (Vector2){0, 0},
-                       0.0f,
-                       (Color){255, 255, 255, alpha});
+        unsigned char alpha = (unsigned char)(opacity * 150.0f);
+        sprite_draw_pro(sprite,
+                        draw_rect,
+                        (Vector2){0, 0},
+                        0.0f,
+                        (Color){255, 255, 255, alpha});
         break;
     }
     case HAZARD_WIND_DAGGERS:
     {
-        DrawTexturePro(hazard->texture,
-                       (Rectangle){0, 0, (float)hazard->texture.width, (float)hazard->texture.height},
-                       draw_rect,
-                       (Vector2){0, 0},
-                       0.0f,
-                       (Color){255, 255, 255, 255});
+        sprite_draw_pro(sprite,
+                        draw_rect,
+                        (Vector2){0, 0},
+                        0.0f,
+                        (Color){255, 255, 255, 255});
         break;
     }
     }
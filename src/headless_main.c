@@ -0,0 +1,205 @@
+#include "game.h"
+#include "asset_paths.h"
+#include "config.h"
+#include "texture_cache.h"
+#include "replay.h"
+#include "input_script.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+
+// Headless runner: steps one level of the simulation as fast as possible with scripted
+// input. No window, GL context or audio device is created.
+//
+// Usage: knight_headless [--level N] [--ticks N] [--seed N] [--script idle|walk|hop]
+//                        [--record FILE] [--replay FILE] [--threads N]
+//
+// --record saves the scripted run as a replay; --replay plays a whole recording instead of
+// the script (level and seed come from the file). The printed checksum covers the final
+// simulation state, so a replay that reproduces its session prints the same value.
+// --threads sets how many threads test collision candidates (default 1, so the timing
+// measured with clock() is the game thread's alone); the checksum does not depend on it.
+
+static void print_usage(void)
+{
+    printf("Usage: knight_headless [--level N] [--ticks N] [--seed N] [--script idle|walk|hop]\n");
+    printf("                       [--record FILE] [--replay FILE] [--threads N]\n");
+}
+
+// FNV-1a over the parts of the state that gameplay can change
+static unsigned int checksum_bytes(unsigned int hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static unsigned int state_checksum(const GameState *state)
+{
+    const Level *level = &state->levels[state->current_level_index];
+    unsigned int hash = 2166136261u;
+    hash = checksum_bytes(hash, &state->current_level_index, sizeof(int));
+    hash = checksum_bytes(hash, &state->player.position, sizeof(Vector2));
+    hash = checksum_bytes(hash, &state->player.velocity, sizeof(Vector2));
+    hash = checksum_bytes(hash, &state->player.hearts, sizeof(int));
+    hash = checksum_bytes(hash, &state->player.projectile_inventory, sizeof(int));
+    hash = checksum_bytes(hash, state->player.inventory.counts, sizeof(state->player.inventory.counts));
+    hash = checksum_bytes(hash, &state->elapsed_time, sizeof(float));
+    for (int i = 0; i < level->monsters.count; i++)
+    {
+        Vector2 position = {level->monsters.x[i], level->monsters.y[i]};
+        hash = checksum_bytes(hash, &position, sizeof(Vector2));
+        hash = checksum_bytes(hash, &level->monsters.active[i], sizeof(bool));
+    }
+    for (int i = 0; i < level->loot.count; i++)
+    {
+        hash = checksum_bytes(hash, &level->loot.loot[i].position, sizeof(Vector2));
+    }
+    return hash;
+}
+
+int main(int argc, char *argv[])
+{
+    int level = 1;
+    long ticks = SIMULATION_TICK_RATE * 60L * 10L; // Ten minutes of game time
+    unsigned int seed = 1;
+    InputScript script = SCRIPT_HOP;
+    bool ticks_given = false;
+    const char *record_path = NULL;
+    const char *replay_path = NULL;
+    int contact_threads = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--level") == 0 && has_value)
+            level = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ticks") == 0 && has_value)
+        {
+            ticks = atol(argv[++i]);
+            ticks_given = true;
+        }
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--record") == 0 && has_value)
+            record_path = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0 && has_value)
+            replay_path = argv[++i];
+        else if (strcmp(argv[i], "--threads") == 0 && has_value)
+            contact_threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--script") == 0 && has_value)
+        {
+            if (!input_script_parse(argv[++i], &script))
+            {
+                print_usage();
+                return 1;
+            }
+        }
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+
+    ReplayPlayer replayer = {0};
+    if (replay_path)
+    {
+        if (!replay_player_open(&replayer, replay_path))
+            return 1;
+        level = replayer.start_level + 1;
+        seed = replayer.seed;
+        if (!ticks_given)
+            ticks = LONG_MAX; // Play the whole recording
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetRandomSeed(seed);
+    init_asset_paths();
+    texture_cache_set_headless(true);
+
+    GameState state = {0};
+    game_sim_init(&state, contact_threads);
+    if (level < 1 || level > state.level_count)
+    {
+        fprintf(stderr, "knight_headless: level must be between 1 and %d\n", state.level_count);
+        game_sim_cleanup(&state);
+        texture_cache_shutdown();
+        return 1;
+    }
+    game_sim_start_level(&state, level - 1);
+
+    ReplayRecorder recorder = {0};
+    if (record_path && !replay_path)
+    {
+        replay_recorder_open(&recorder, record_path, seed, level - 1);
+    }
+
+    const char *outcome = "time limit";
+    long tick = 0;
+    clock_t start = clock();
+    for (; tick < ticks; tick++)
+    {
+        PlayerInput input = input_script_next(script, tick, &state);
+        if (replay_path)
+        {
+            ReplayTick recorded;
+            if (!replay_player_next(&replayer, &recorded))
+            {
+                outcome = "end of replay";
+                break;
+            }
+            if (state.in_level_transition)
+            {
+                game_sim_advance_level(&state);
+            }
+            state.pause_menu_active = recorded.pause_menu_active;
+            input = recorded.input;
+        }
+        else if (recorder.file)
+        {
+            ReplayTick recorded = {input, false};
+            replay_recorder_write(&recorder, &recorded);
+        }
+
+        game_step(&state, &input, SIMULATION_DT);
+
+        // Replays carry on through level transitions like the recorded session did
+        if ((state.in_level_transition && !replay_path) || state.game_victory)
+        {
+            outcome = "goal reached";
+            tick++;
+            break;
+        }
+        if (state.current_screen == GAME_SCREEN_TITLE)
+        {
+            outcome = "game over";
+            tick++;
+            break;
+        }
+    }
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    double simulated = (double)tick / SIMULATION_TICK_RATE;
+
+    replay_recorder_close(&recorder);
+    replay_player_close(&replayer);
+
+    printf("level %d, seed %u, %s %s\n", level, seed, replay_path ? "replay" : "script",
+           replay_path ? replay_path : input_script_name(script));
+    printf("ticks: %ld (%.1f s simulated) in %.3f s", tick, simulated, seconds);
+    if (seconds > 0.0)
+        printf(" -> %.0f ticks/s (%.0fx real time)", tick / seconds, simulated / seconds);
+    printf("\n");
+    printf("outcome: %s\n", outcome);
+    printf("player: x=%.1f y=%.1f hearts=%d\n", state.player.position.x, state.player.position.y, state.player.hearts);
+    printf("checksum: %08x\n", state_checksum(&state));
+
+    game_sim_cleanup(&state);
+    texture_cache_shutdown();
+    return 0;
+}
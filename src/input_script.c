@@ -0,0 +1,45 @@
+#include "input_script.h"
+#include "config.h"
+#include <string.h>
+
+static const char *script_names[SCRIPT_COUNT] = {"idle", "walk", "hop"};
+
+PlayerInput input_script_next(InputScript script, long tick, const GameState *state)
+{
+    PlayerInput input = {0};
+    if (script == SCRIPT_IDLE)
+        return input;
+
+    input.move_right = true;
+    if (script == SCRIPT_HOP)
+    {
+        input.jump = (tick % SIMULATION_TICK_RATE) == 0;
+        input.sword = (tick / (SIMULATION_TICK_RATE / 2)) % 2 == 1;
+        if (state->player.projectile_inventory > 0 && (tick % (SIMULATION_TICK_RATE / 4)) == 0)
+        {
+            input.fire = true;
+            input.fire_target = (Vector2){state->player.position.x + 400.0f, state->player.position.y};
+        }
+    }
+    return input;
+}
+
+bool input_script_parse(const char *name, InputScript *script)
+{
+    for (int i = 0; i < SCRIPT_COUNT; i++)
+    {
+        if (strcmp(name, script_names[i]) == 0)
+        {
+            *script = (InputScript)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *input_script_name(InputScript script)
+{
+    if (script < 0 || script >= SCRIPT_COUNT)
+        return "unknown";
+    return script_names[script];
+}
@@ -1,4 +1,6 @@
 #include "level.h"
+#include "config.h"
+#include "trace.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -15,11 +17,14 @@ Level level_create(int level_number, const char *name, BackgroundConfig backgrou
     level.player_start_position = start_pos;
     level.goal = goal;
     level.completed = false;
-    level.hazards = hazard_list_create(20);          // Max 10 hazards per level
-    level.monsters = monster_list_create(20);        // Max 20 monsters per level
-    level.pickups = pickup_list_create(500);         // Max 20 pickups per level
+    // Initial capacities; the entity lists grow as needed
+    level.hazards = hazard_list_create(20);
+    level.monsters = monster_list_create(20);
+    level.pickups = pickup_list_create(64);
+    level.pickup_pool = pickup_pool_create(16);
     level.spawners = pickup_spawner_list_create(10); // Max 10 spawners per level
-    level.loot = loot_list_create(100);              // Max 100 active loot items per level
+    level.loot = loot_list_create(100);
+    level.clock = 0;
 
     return level;
 }
@@ -34,6 +39,7 @@ void level_cleanup(Level *level)
     hazard_list_cleanup(&level->hazards);
     monster_list_cleanup(&level->monsters);
     pickup_list_cleanup(&level->pickups);
+    pickup_pool_cleanup(&level->pickup_pool);
     pickup_spawner_list_cleanup(&level->spawners);
     loot_list_cleanup(&level->loot);
 }
@@ -90,30 +96,36 @@ bool level_check_goal_reached(Level *level, Vector2 player_pos)
     return false;
 }
 
-void level_reset(Level *level)
+void level_reset(Level *level, TimerWheel *world_timers)
 {
+    TRACE_BEGIN("level_reset");
     level->completed = false;
     level->goal.hazards_defeated = 0;
     level->goal.monsters_defeated = 0;
 
-    // Reset all hazards to their initial positions
+    // Hazards and patrols are functions of the level clock; starting it over resets them
+    level->clock = 0;
     for (int i = 0; i < level->hazards.count; i++)
     {
         hazard_reset(&level->hazards.hazards[i]);
     }
+    monster_list_restart(&level->monsters);
 
     // Reset all spawner timers
-    for (int i = 0; i < level->spawners.count; i++)
-    {
-        level->spawners.spawners[i].spawn_timer = level->spawners.spawners[i].spawn_interval;
-    }
+    pickup_spawner_list_restart(&level->spawners, world_timers);
 
-    // Reset all pickups to active
+    // Spawned pickups don't outlive the attempt; they go back to the pool
     for (int i = 0; i < level->pickups.count; i++)
     {
-        level->pickups.pickups[i].active = true;
-        level->pickups.pickups[i].lifetime = level->pickups.pickups[i].max_lifetime;
+        level->pickups.pickups[i].active = false;
     }
+    pickup_list_recycle(&level->pickups, &level->spawners, &level->pickup_pool);
+    TRACE_END("level_reset");
+}
+
+double level_time(const Level *level)
+{
+    return level->clock * (double)SIMULATION_DT;
 }
 
 void level_reactivate_enemies(Level *level)
@@ -121,9 +133,9 @@ void level_reactivate_enemies(Level *level)
     // Reactivate all monsters with full health
     for (int i = 0; i < level->monsters.count; i++)
     {
-        level->monsters.monsters[i].active = true;
-        level->monsters.monsters[i].hearts = level->monsters.monsters[i].max_hearts;
-        level->monsters.monsters[i].dead_texture_timer = 0.0f;
+        level->monsters.active[i] = true;
+        level->monsters.hearts[i] = level->monsters.cold[i].max_hearts;
+        level->monsters.dead_texture_timer[i] = 0.0f;
     }
 
     // Reactivate all hazards
@@ -1,5 +1,4 @@
 #include "level.h"
-#include "dragon.h"
 
 /*
  * Level 6: Final Challenge
@@ -48,14 +47,10 @@ Level level10_create(void)
         850.0f,                 // patrol left boundary
         950.0f,                 // patrol right boundary
         90.0f,                  // patrol speed
-        "../assets/dragon.png", // texture path
-        0.5f,// scale
-    "dragon"
+        MONSTER_DRAGON, // archetype
+        0.5f // scale
     );
 
-    // Apply dragon-specific customizations
-    dragon_apply_customizations(&dragon);
-
     monster_list_add(&level.monsters, dragon);
     Monster baby1 = monster_create(
         800.0f,                 // x position
@@ -66,9 +61,8 @@ Level level10_create(void)
         650.0f,                 // patrol left boundary
         850.0f,                 // patrol right boundary
         135.0f,                  // patrol speed
-        "../assets/baby_dragon.png", // texture path
-        0.18f,// scale
-    "dragon"
+        MONSTER_BABY_DRAGON, // archetype
+        0.18f // scale
     );
     monster_list_add(&level.monsters, baby1);
     return level;
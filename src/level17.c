@@ -61,9 +61,8 @@ Level level17_create(void)
         820.0f,                    // patrol left boundary
         1000.0f,                    // patrol right boundary
         80.0f,                     // patrol speed
-        "monster_slug.png", // texture path
-        0.1f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, trial_slug);
     // Add bat monster patrolling in the middle area
@@ -76,9 +75,8 @@ Level level17_create(void)
         650.0f,           // patrol left boundary
         850.0f,           // patrol right boundary
         150.0f,           // patrol speed
-        "bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, trial_bat);
 
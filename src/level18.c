@@ -61,9 +61,8 @@ Level level18_create(void)
         1030.0f,                    // patrol left boundary
         1130.0f,                    // patrol right boundary
         80.0f,                     // patrol speed
-        "monster_slug.png", // texture path
-        0.16f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.16f // scale
     );
     monster_list_add(&level.monsters, trial_slug2);
     // Add bat monster patrolling in the middle area
@@ -105,9 +104,8 @@ Level level18_create(void)
         1140.0f,            // patrol left boundary
         1510.0f,           // patrol right boundary
         170.0f,            // patrol speed
-        "crab.png", // texture path
-        0.12f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.12f // scale
     );
     monster_list_add(&level.monsters, trial_crab);
     
@@ -61,9 +61,8 @@ Level level19_create(void)
         1030.0f,                    // patrol left boundary
         1130.0f,                    // patrol right boundary
         80.0f,                     // patrol speed
-        "monster_slug.png", // texture path
-        0.16f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.16f // scale
     );
     monster_list_add(&level.monsters, trial_slug2);
     // Add bat monster patrolling in the middle area
@@ -105,9 +104,8 @@ Level level19_create(void)
         1140.0f,            // patrol left boundary
         1510.0f,           // patrol right boundary
         170.0f,            // patrol speed
-        "crab.png", // texture path
-        0.12f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.12f // scale
     );
     monster_list_add(&level.monsters, trial_crab);
 
@@ -120,9 +118,8 @@ Level level19_create(void)
         1520.0f,            // patrol left boundary
         1980.0f,           // patrol right boundary
         165.0f,            // patrol speed
-        "crab.png", // texture path
-        0.15f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.15f // scale
     );
     monster_list_add(&level.monsters, trial_crab2);
 
@@ -156,9 +153,8 @@ Level level19_create(void)
         2200.0f,                      // patrol left boundary
         2500.0f,                      // patrol right boundary
         100.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, trial_bat2);
 
@@ -171,9 +167,8 @@ Level level19_create(void)
         2550.0f,            // patrol left boundary
         3000.0f,           // patrol right boundary
         165.0f,            // patrol speed
-        "crab.png", // texture path
-        0.15f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.15f // scale
     );
     monster_list_add(&level.monsters, trial_crab3);
 
@@ -220,9 +215,8 @@ Level level19_create(void)
         3700.0f,            // patrol left boundary
         4500.0f,           // patrol right boundary
         100.0f,            // patrol speed
-        "baby_dragon.png", // texture path
-        0.2f,// scale
-    "dragon"
+        MONSTER_BABY_DRAGON, // archetype
+        0.2f // scale
     );
     monster_list_add(&level.monsters, trial_dragon);
 
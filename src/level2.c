@@ -47,9 +47,8 @@ Level level2_create(void)
         400.0f,    // patrol left boundary
         800.0f,    // patrol right boundary
         150.0f,    // patrol speed
-        "bat.png", // texture path
-        0.08f,     // scale
-        "bat"      // monster type for loot lookup
+        MONSTER_BAT, // archetype
+        0.08f     // scale
     );
     monster_list_add(&level.monsters, bat);
     PickupSpawner test_pickup = pickup_spawner_create(
@@ -46,9 +46,8 @@ Level level3_create(void)
         300.0f,             // patrol left boundary
         700.0f,             // patrol right boundary
         80.0f,              // patrol speed
-        "monster_slug.png", // texture path
-        0.1f,               // scale
-        "slug"              // monster type for loot lookup
+        MONSTER_SLUG, // archetype
+        0.1f               // scale
     );
     monster_list_add(&level.monsters, slug);
     // Add bat monster patrolling in the middle area
@@ -61,9 +60,8 @@ Level level3_create(void)
         100.0f,    // patrol left boundary
         600.0f,    // patrol right boundary
         150.0f,    // patrol speed
-        "bat.png", // texture path
-        0.08f,     // scale
-        "bat"      // monster type for loot lookup
+        MONSTER_BAT, // archetype
+        0.08f     // scale
     );
     monster_list_add(&level.monsters, bat2);
     return level;
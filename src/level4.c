@@ -46,9 +46,8 @@ Level level4_create(void)
         300.0f,             // patrol left boundary
         700.0f,             // patrol right boundary
         80.0f,              // patrol speed
-        "monster_slug.png", // texture path
-        0.1f,               // scale
-        "slug"              // monster type for loot lookup
+        MONSTER_SLUG, // archetype
+        0.1f               // scale
     );
     monster_list_add(&level.monsters, slug);
     // Add bat monster patrolling in the middle area
@@ -61,9 +60,8 @@ Level level4_create(void)
         100.0f,    // patrol left boundary
         600.0f,    // patrol right boundary
         150.0f,    // patrol speed
-        "bat.png", // texture path
-        0.08f,     // scale
-        "bat"      // monster type for loot lookup
+        MONSTER_BAT, // archetype
+        0.08f     // scale
     );
     Monster slug2 = monster_create(
         600.0f,             // x position
@@ -74,9 +72,8 @@ Level level4_create(void)
         600.0f,             // patrol left boundary
         900.0f,             // patrol right boundary
         80.0f,              // patrol speed
-        "monster_slug.png", // texture path
-        0.1f,               // scale
-        "slug"              // monster type for loot lookup
+        MONSTER_SLUG, // archetype
+        0.1f               // scale
     );
     Monster bat3 = monster_create(
         400.0f,    // x position
@@ -87,9 +84,8 @@ Level level4_create(void)
         1000.0f,   // patrol left boundary
         1600.0f,   // patrol right boundary
         150.0f,    // patrol speed
-        "bat.png", // texture path
-        0.35f,     // scale
-        "boss"     // monster type for loot lookup
+        MONSTER_BOSS, // archetype
+        0.35f     // scale
     );
     Monster slug3 = monster_create(
         600.0f,             // x position
@@ -100,9 +96,8 @@ Level level4_create(void)
         1600.0f,            // patrol left boundary
         2000.0f,            // patrol right boundary
         100.0f,             // patrol speed
-        "monster_slug.png", // texture path
-        0.07f,              // scale
-        "slug"              // monster type for loot lookup
+        MONSTER_SLUG, // archetype
+        0.07f              // scale
     );
     monster_list_add(&level.monsters, bat2);
     monster_list_add(&level.monsters, bat3);
@@ -46,9 +46,8 @@ Level level5_create(void)
         300.0f,                    // patrol left boundary
         700.0f,                    // patrol right boundary
         80.0f,                     // patrol speed
-        "monster_slug.png", // texture path
-        0.1f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, slug);
     // Add bat monster patrolling in the middle area
@@ -61,9 +60,8 @@ Level level5_create(void)
         100.0f,           // patrol left boundary
         600.0f,           // patrol right boundary
         150.0f,           // patrol speed
-        "bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     Monster crab = monster_create(
         600.0f,            // x position
@@ -74,9 +72,8 @@ Level level5_create(void)
         900.0f,            // patrol left boundary
         1700.0f,           // patrol right boundary
         150.0f,            // patrol speed
-        "crab.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.1f // scale
     );
     Monster bat3 = monster_create(
         400.0f,           // x position
@@ -87,9 +84,8 @@ Level level5_create(void)
         1000.0f,          // patrol left boundary
         1600.0f,          // patrol right boundary
         150.0f,           // patrol speed
-        "bat.png", // texture path
-        0.35f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.35f // scale
     );
     Monster slug3 = monster_create(
         600.0f,                    // x position
@@ -100,9 +96,8 @@ Level level5_create(void)
         1600.0f,                   // patrol left boundary
         2000.0f,                   // patrol right boundary
         100.0f,                    // patrol speed
-        "monster_slug.png", // texture path
-        0.07f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.07f // scale
     );
     Monster bat4 = monster_create(
         750.0f,           // x position
@@ -113,9 +108,8 @@ Level level5_create(void)
         1200.0f,          // patrol left boundary
         1800.0f,          // patrol right boundary
         120.0f,           // patrol speed
-        "bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     Monster slug4 = monster_create(
         850.0f,                    // x position
@@ -126,9 +120,8 @@ Level level5_create(void)
         800.0f,                    // patrol left boundary
         1100.0f,                   // patrol right boundary
         90.0f,                     // patrol speed
-        "monster_slug.png", // texture path
-        0.09f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.09f // scale
     );
     Monster bat5 = monster_create(
         1200.0f,          // x position
@@ -139,9 +132,8 @@ Level level5_create(void)
         1100.0f,          // patrol left boundary
         1900.0f,          // patrol right boundary
         110.0f,           // patrol speed
-        "bat.png", // texture path
-        0.06f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.06f // scale
     );
     monster_list_add(&level.monsters, bat2);
     monster_list_add(&level.monsters, crab);
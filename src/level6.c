@@ -46,9 +46,8 @@ Level level6_create(void)
         650.0f,            // patrol left boundary
         1100.0f,           // patrol right boundary
         170.0f,            // patrol speed
-        "crab.png", // texture path
-        0.12f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.12f // scale
     );
     monster_list_add(&level.monsters, crab1);
 
@@ -62,9 +61,8 @@ Level level6_create(void)
         1100.0f,           // patrol left boundary
         1900.0f,           // patrol right boundary
         160.0f,            // patrol speed
-        "crab.png", // texture path
-        0.13f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.13f // scale
     );
     monster_list_add(&level.monsters, crab2);
     Monster crab3 = monster_create(
@@ -76,9 +74,8 @@ Level level6_create(void)
         1900.0f,           // patrol left boundary
         2300.0f,           // patrol right boundary
         170.0f,            // patrol speed
-        "crab.png", // texture path
-        0.12f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.12f // scale
     );
     monster_list_add(&level.monsters, crab3);
 
@@ -92,9 +89,8 @@ Level level6_create(void)
         2300.0f,           // patrol left boundary
         2700.0f,           // patrol right boundary
         160.0f,            // patrol speed
-        "crab.png", // texture path
-        0.13f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.13f // scale
     );
     monster_list_add(&level.monsters, crab4);
     Monster Crabono = monster_create(
@@ -106,9 +102,8 @@ Level level6_create(void)
         800.0f,            // patrol left boundary
         2700.0f,           // patrol right boundary
         140.0f,            // patrol speed
-        "crab.png", // texture path
-        0.19f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.19f // scale
     );
     monster_list_add(&level.monsters, Crabono);
     Monster crab5 = monster_create(
@@ -120,9 +115,8 @@ Level level6_create(void)
         1900.0f,           // patrol left boundary
         2700.0f,           // patrol right boundary
         170.0f,            // patrol speed
-        "crab.png", // texture path
-        0.12f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.12f // scale
     );
     monster_list_add(&level.monsters, crab5);
 
@@ -136,9 +130,8 @@ Level level6_create(void)
         800.0f,            // patrol left boundary
         1900.0f,           // patrol right boundary
         170.0f,            // patrol speed
-        "crab.png", // texture path
-        0.13f,// scale
-    "bat"
+        MONSTER_CRAB, // archetype
+        0.13f // scale
     );
     monster_list_add(&level.monsters, crab6);
 
@@ -46,9 +46,8 @@ Level level8_create(void)
         650.0f,                    // patrol left boundary
         1100.0f,                   // patrol right boundary
         120.0f,                    // patrol speed
-        "monster_slug.png", // texture path
-        0.08f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, slug1);
 
@@ -62,9 +61,8 @@ Level level8_create(void)
         1100.0f,                   // patrol left boundary
         1900.0f,                   // patrol right boundary
         140.0f,                    // patrol speed
-        "monster_slug.png", // texture path
-        0.16f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.16f // scale
     );
     monster_list_add(&level.monsters, slug2);
 
@@ -78,9 +76,8 @@ Level level8_create(void)
         1900.0f,                   // patrol left boundary
         2300.0f,                   // patrol right boundary
         120.0f,                    // patrol speed
-        "monster_slug.png", // texture path
-        0.09f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.09f // scale
     );
     monster_list_add(&level.monsters, slug3);
 
@@ -94,9 +91,8 @@ Level level8_create(void)
         2300.0f,                   // patrol left boundary
         2700.0f,                   // patrol right boundary
         100.0f,                    // patrol speed
-        "monster_slug.png", // texture path
-        0.14f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.14f // scale
     );
     monster_list_add(&level.monsters, slug4);
 
@@ -110,9 +106,8 @@ Level level8_create(void)
         800.0f,                    // patrol left boundary
         3500.0f,                   // patrol right boundary
         80.0f,                     // patrol speed
-        "monster_slug.png", // texture path
-        0.35f,// scale - really big!
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.35f // scale - really big!
     );
     monster_list_add(&level.monsters, Sluggato);
 
@@ -126,9 +121,8 @@ Level level8_create(void)
         1900.0f,                   // patrol left boundary
         2700.0f,                   // patrol right boundary
         110.0f,                    // patrol speed
-        "monster_slug.png", // texture path
-        0.11f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.11f // scale
     );
     monster_list_add(&level.monsters, slug5);
 
@@ -142,9 +136,8 @@ Level level8_create(void)
         800.0f,                    // patrol left boundary
         1900.0f,                   // patrol right boundary
         100.0f,                    // patrol speed
-        "monster_slug.png", // texture path
-        0.13f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.13f // scale
     );
     monster_list_add(&level.monsters, slug6);
     Monster slug7 = monster_create(
@@ -156,9 +149,8 @@ Level level8_create(void)
         3100.0f,                   // patrol left boundary
         3500.0f,                   // patrol right boundary
         90.0f,                     // patrol speed
-        "monster_slug.png", // texture path
-        0.16f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.16f // scale
     );
     monster_list_add(&level.monsters, slug7);
     Monster slug8 = monster_create(
@@ -170,9 +162,8 @@ Level level8_create(void)
         2700.0f,                   // patrol left boundary
         3100.0f,                   // patrol right boundary
         90.0f,                     // patrol speed
-        "monster_slug.png", // texture path
-        0.16f,// scale
-    "slug"
+        MONSTER_SLUG, // archetype
+        0.16f // scale
     );
     monster_list_add(&level.monsters, slug8);
 
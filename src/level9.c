@@ -47,9 +47,8 @@ Level level9_create(void)
         650.0f,                       // patrol left boundary
         1100.0f,                      // patrol right boundary
         120.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, guard);
 
@@ -63,9 +62,8 @@ Level level9_create(void)
         1100.0f,                      // patrol left boundary
         1900.0f,                      // patrol right boundary
         140.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, guard1);
 
@@ -79,9 +77,8 @@ Level level9_create(void)
         1900.0f,                      // patrol left boundary
         2300.0f,                      // patrol right boundary
         120.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, guard2);
 
@@ -95,9 +92,8 @@ Level level9_create(void)
         2300.0f,                      // patrol left boundary
         2700.0f,                      // patrol right boundary
         100.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, guard3);
 
@@ -111,9 +107,8 @@ Level level9_create(void)
         800.0f,                       // patrol left boundary
         3500.0f,                      // patrol right boundary
         80.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale - really big!
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale - really big!
     );
     monster_list_add(&level.monsters, guard4);
 
@@ -127,9 +122,8 @@ Level level9_create(void)
         1900.0f,                      // patrol left boundary
         2700.0f,                      // patrol right boundary
         110.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, guard5);
 
@@ -143,9 +137,8 @@ Level level9_create(void)
         800.0f,                       // patrol left boundary
         1900.0f,                      // patrol right boundary
         100.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, guard6);
         Monster guard7 = monster_create(
@@ -157,9 +150,8 @@ Level level9_create(void)
         3100.0f,                      // patrol left boundary
         3500.0f,                      // patrol right boundary
         90.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, guard7);
         Monster guard8 = monster_create(
@@ -171,9 +163,8 @@ Level level9_create(void)
         2700.0f,                      // patrol left boundary
         3100.0f,                      // patrol right boundary
         90.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, guard8);
         // Add unique slug 3
@@ -186,9 +177,8 @@ Level level9_create(void)
         1700.0f,                      // patrol left boundary
         2100.0f,                      // patrol right boundary
         145.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, guard9);
 
@@ -202,9 +192,8 @@ Level level9_create(void)
         2100.0f,                      // patrol left boundary
         2500.0f,                      // patrol right boundary
         135.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, guard10);
 
@@ -218,9 +207,8 @@ Level level9_create(void)
         600.0f,                       // patrol left boundary
         3300.0f,                      // patrol right boundary
         135.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale - really big!
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale - really big!
     );
     monster_list_add(&level.monsters, guard11);
 
@@ -234,9 +222,8 @@ Level level9_create(void)
         1700.0f,                      // patrol left boundary
         2500.0f,                      // patrol right boundary
         135.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, guard12);
 
@@ -250,9 +237,8 @@ Level level9_create(void)
         600.0f,                       // patrol left boundary
         1700.0f,                      // patrol right boundary
         145.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, guard13);
         Monster guard14 = monster_create(
@@ -264,9 +250,8 @@ Level level9_create(void)
         2900.0f,                      // patrol left boundary
         3300.0f,                      // patrol right boundary
         135.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, guard14);
         Monster guard15 = monster_create(
@@ -278,9 +263,8 @@ Level level9_create(void)
         2500.0f,                      // patrol left boundary
         2900.0f,                      // patrol right boundary
         145.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, guard15);
        // Add unique slug 5
@@ -294,9 +278,8 @@ Level level9_create(void)
         1800.0f,                      // patrol left boundary
         2600.0f,                      // patrol right boundary
         130.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, guard16);
 
@@ -310,9 +293,8 @@ Level level9_create(void)
         700.0f,                       // patrol left boundary
         1800.0f,                      // patrol right boundary
         140.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, guard17);
         Monster guard18 = monster_create(
@@ -324,9 +306,8 @@ Level level9_create(void)
         3000.0f,                      // patrol left boundary
         3400.0f,                      // patrol right boundary
         130.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.1f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.1f // scale
     );
     monster_list_add(&level.monsters, guard18);
         Monster guard19 = monster_create(
@@ -338,9 +319,8 @@ Level level9_create(void)
         2600.0f,                      // patrol left boundary
         3000.0f,                      // patrol right boundary
         140.0f,                       // patrol speed
-        "../assets/bat.png", // texture path
-        0.08f,// scale
-    "bat"
+        MONSTER_BAT, // archetype
+        0.08f // scale
     );
     monster_list_add(&level.monsters, guard19);
 
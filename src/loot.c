@@ -1,12 +1,15 @@
 #include "loot.h"
-#include "asset_paths.h"
 #include "config.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
-// Forward declaration
-static Texture2D load_loot_texture(LootType type);
+// Dropped loot falls and lands on the ground, spinning until it despawns
+static const BodyKind loot_body_kind = {300.0f, 5.0f, GROUND_Y, INFINITY};
+
+// Forward declarations
+static const char *loot_texture_name(LootType type);
+static TextureHandle loot_fallback_texture(LootType type);
 
 // ============ LOOT SYSTEM FUNCTIONS ============
 
@@ -117,6 +120,7 @@ Loot loot_create(LootType type, Vector2 spawn_pos, int value, const Inventory *i
 {
     Loot loot = {0};
     loot.position = spawn_pos;
+    loot.previous_position = spawn_pos;
     loot.velocity = (Vector2){0, -200.0f}; // Move upward initially
     loot.type = type;
     loot.value = value;
@@ -134,8 +138,8 @@ Loot loot_create(LootType type, Vector2 spawn_pos, int value, const Inventory *i
     }
     else
     {
-        // Fallback to loading texture directly
-        loot.texture = load_loot_texture(type);
+        // Fallback to the module's own cached reference
+        loot.texture = loot_fallback_texture(type);
     }
 
     switch (type)
@@ -159,54 +163,6 @@ Loot loot_create(LootType type, Vector2 spawn_pos, int value, const Inventory *i
     return loot;
 }
 
-void loot_apply_gravity(Loot *loot)
-{
-    if (loot->on_ground)
-        return;
-
-    float gravity = 300.0f;
-    loot->velocity.y += gravity * GetFrameTime();
-
-    // Check if reached ground level (GROUND_Y from config.h)
-    float loot_bottom = loot->position.y;
-    if (loot_bottom >= GROUND_Y)
-    {
-        loot->position.y = GROUND_Y;
-        loot->velocity.y = 0;
-        loot->on_ground = true;
-    }
-}
-
-void loot_update(Loot *loot)
-{
-    if (!loot->active)
-        return;
-
-    // Apply physics
-    loot_apply_gravity(loot);
-
-    // Update position
-    loot->position.x += loot->velocity.x * GetFrameTime();
-    loot->position.y += loot->velocity.y * GetFrameTime();
-
-    // Update rotation for visual effect
-    loot->rotation += 5.0f * GetFrameTime();
-
-    // Update lifetime
-    loot->lifetime -= GetFrameTime();
-    if (loot->lifetime <= 0.0f)
-    {
-        loot->active = false;
-    }
-
-    // Despawn if goes too far off-screen
-    float screen_x = loot->position.x - GetScreenWidth() / 2.0f;
-    if (screen_x < -1000.0f || screen_x > GetScreenWidth() + 1000.0f)
-    {
-        loot->active = false;
-    }
-}
-
 void loot_draw(Loot *loot, float camera_x)
 {
     if (!loot->active)
@@ -217,15 +173,15 @@ void loot_draw(Loot *loot, float camera_x)
     float screen_y = loot->position.y;
 
     // Draw texture if loaded, otherwise draw placeholder circle
-    if (loot->texture.id != 0)
+    Sprite sprite = texture_cache_get_sprite(loot->texture);
+    if (sprite.texture.id != 0)
     {
-        Rectangle source = {0, 0, (float)loot->texture.width, (float)loot->texture.height};
         Rectangle dest = {screen_x, screen_y,
-                          loot->texture.width * loot->scale,
-                          loot->texture.height * loot->scale};
+                          sprite.source.width * loot->scale,
+                          sprite.source.height * loot->scale};
         Vector2 origin = {dest.width / 2.0f, dest.height / 2.0f};
 
-        DrawTexturePro(loot->texture, source, dest, origin, loot->rotation, WHITE);
+        sprite_draw_pro(sprite, dest, origin, loot->rotation, WHITE);
     }
     else
     {
@@ -236,89 +192,101 @@ void loot_draw(Loot *loot, float camera_x)
 
 // ============ LOOT LIST FUNCTIONS ============
 
-LootList loot_list_create(int capacity)
-{
-    LootList list = {0};
-    list.loot = malloc(sizeof(Loot) * capacity);
-    list.capacity = capacity;
-    list.count = 0;
-    return list;
-}
+// Loot textures are borrowed from the inventory, so items need no release
+SLOT_MAP_DEFINE(LootList, Loot, loot, loot_list, SLOT_MAP_NO_HOOK, SLOT_MAP_NO_HOOK)
 
-void loot_list_add(LootList *list, Loot loot)
+int loot_list_update(LootList *list, BodyBatch *bodies, const SectorWindow *awake, float camera_x, float delta_time)
 {
-    if (list->count >= list->capacity)
+    // Integrate every awake item in one batch, then copy the results back
+    int frozen = 0;
+    body_batch_begin(bodies, list->count);
+    for (int i = 0; i < list->count; i++)
     {
-        list->capacity *= 2;
-        list->loot = realloc(list->loot, sizeof(Loot) * list->capacity);
-    }
-    list->loot[list->count++] = loot;
-}
+        Loot *loot = &list->loot[i];
+        if (!loot->active)
+            continue;
 
-void loot_list_cleanup(LootList *list)
-{
-    free(list->loot);
-    list->loot = NULL;
-}
+        if (sector_window_contains(awake, loot->position.x))
+            body_batch_add(bodies, i, loot->position, loot->velocity, loot->rotation, loot->lifetime, loot->on_ground);
+        else
+            frozen++;
+    }
+    body_batch_integrate(bodies, &loot_body_kind, camera_x, delta_time);
 
-void loot_list_update(LootList *list)
-{
-    for (int i = 0; i < list->count; i++)
+    for (int b = 0; b < bodies->count; b++)
     {
-        if (list->loot[i].active)
-        {
-            loot_update(&list->loot[i]);
-        }
+        Loot *loot = &list->loot[bodies->source[b]];
+        loot->previous_position = loot->position;
+        loot->position = (Vector2){bodies->x[b], bodies->y[b]};
+        loot->velocity.y = bodies->velocity_y[b];
+        loot->rotation = bodies->rotation[b];
+        loot->lifetime = bodies->lifetime[b];
+        loot->on_ground = bodies->grounded[b] != 0;
+    }
+    for (int e = 0; e < bodies->expired_count; e++)
+    {
+        list->loot[bodies->expired[e]].active = false;
     }
 
-    // Compact array to remove inactive items
-    int write_idx = 0;
-    for (int read_idx = 0; read_idx < list->count; read_idx++)
+    // Drop expired and collected loot; the last item fills each hole
+    for (int i = 0; i < list->count;)
     {
-        if (list->loot[read_idx].active)
-        {
-            list->loot[write_idx++] = list->loot[read_idx];
-        }
+        if (list->loot[i].active)
+            i++;
+        else
+            loot_list_remove_at(list, i);
     }
-    list->count = write_idx;
+    return frozen;
 }
 
-void loot_list_draw(LootList *list, float camera_x)
+void loot_list_draw(LootList *list, float camera_x, float alpha)
 {
     for (int i = 0; i < list->count; i++)
     {
         if (list->loot[i].active)
         {
-            loot_draw(&list->loot[i], camera_x);
+            // Blend between the last two updates, like the player
+            Loot render_loot = list->loot[i];
+            render_loot.position.x = render_loot.previous_position.x + (render_loot.position.x - render_loot.previous_position.x) * alpha;
+            render_loot.position.y = render_loot.previous_position.y + (render_loot.position.y - render_loot.previous_position.y) * alpha;
+            loot_draw(&render_loot, camera_x);
         }
     }
 }
 
 // ============ TEXTURE LOADING FUNCTIONS ============
 
-static Texture2D load_loot_texture(LootType type)
+static const char *loot_texture_name(LootType type)
 {
-    const char *texture_path = NULL;
-
     switch (type)
     {
     case LOOT_COIN:
-        texture_path = "loot_coin.png";
-        break;
+        return "loot_coin.png";
     case LOOT_HEALTH_POTION:
-        texture_path = "health_potion.png"; // May need to create this asset
-        break;
+        return "health_potion.png"; // May need to create this asset
     case PROTECTION_POTION:
-        texture_path = "protection_potion.png"; // May need to create this asset
-        break;
+        return "protection_potion.png"; // May need to create this asset
     case LOOT_FIREBALL:
-        texture_path = "fireball.png";
-        break;
+        return "fireball.png";
     default:
-        return (Texture2D){0};
+        return NULL;
     }
+}
+
+// Loot created without an inventory borrows a reference held by this module.
+// It is acquired once per type and lives until texture_cache_shutdown().
+static TextureHandle loot_fallback_texture(LootType type)
+{
+    static TextureHandle fallback_textures[LOOT_TYPE_COUNT] = {0};
 
-    return LoadTexture(get_asset_path(texture_path));
+    if (type >= LOOT_TYPE_COUNT)
+        return TEXTURE_HANDLE_INVALID;
+
+    if (texture_cache_ref_count(fallback_textures[type]) == 0)
+    {
+        fallback_textures[type] = texture_cache_acquire(loot_texture_name(type));
+    }
+    return fallback_textures[type];
 }
 
 // ============ INVENTORY FUNCTIONS ============
@@ -330,8 +298,8 @@ Inventory inventory_create(void)
     for (int i = 0; i < LOOT_TYPE_COUNT; i++)
     {
         inv.counts[i] = 0;
-        // Load texture for this loot type
-        inv.loot_textures[i] = load_loot_texture((LootType)i);
+        // Acquire texture for this loot type (loaded once, shared with world loot)
+        inv.loot_textures[i] = texture_cache_acquire(loot_texture_name((LootType)i));
     }
     return inv;
 }
@@ -366,8 +334,12 @@ bool inventory_remove_loot(Inventory *inv, LootType type, int value)
 
 void inventory_cleanup(Inventory *inv)
 {
-    // Unload textures if they were loaded
-    // TODO: Implement when textures are loaded
+    // Release the texture references acquired in inventory_create
+    for (int i = 0; i < LOOT_TYPE_COUNT; i++)
+    {
+        texture_cache_release(inv->loot_textures[i]);
+        inv->loot_textures[i] = TEXTURE_HANDLE_INVALID;
+    }
 }
 
 void inventory_draw_ui(const Inventory *inv, int screen_width, int screen_height)
@@ -394,13 +366,12 @@ void inventory_draw_ui(const Inventory *inv, int screen_width, int screen_height
         DrawRectangle((int)x, (int)y, (int)icon_size, (int)icon_size, LIGHTGRAY);
 
         // Draw texture if loaded
-        if (inv->loot_textures[type].id != 0)
+        Sprite sprite = texture_cache_get_sprite(inv->loot_textures[type]);
+        if (sprite.texture.id != 0)
         {
-            Rectangle source = {0, 0, (float)inv->loot_textures[type].width,
-                                (float)inv->loot_textures[type].height};
             Rectangle dest = {x + 2, y + 2, icon_size - 4, icon_size - 4};
             Vector2 origin = {0, 0};
-            DrawTexturePro(inv->loot_textures[type], source, dest, origin, 0, WHITE);
+            sprite_draw_pro(sprite, dest, origin, 0, WHITE);
         }
         else
         {
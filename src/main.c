@@ -1,9 +1,81 @@
 #include "game.h"
 #include "asset_paths.h"
+#include "config.h"
+#include "replay.h"
+#include "profiler.h"
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
-int main(void)
+// Input recording (--record <file>) captures the first session started from the title screen.
+// Replay (--replay <file>) plays a recording back, then hands control to the player.
+static const char *record_path = NULL;
+static ReplayRecorder recorder = {0};
+static bool recording_done = false;
+static ReplayPlayer replayer = {0};
+static bool replaying = false;
+
+// Begin recording as soon as a level starts, reseeding the RNG so loot drops can be reproduced
+static void start_recording_if_needed(GameState *state)
+{
+    if (!record_path || recorder.file || recording_done || state->current_screen != GAME_SCREEN_PLAYING)
+        return;
+
+    unsigned int seed = (unsigned int)time(NULL);
+    SetRandomSeed(seed);
+    recording_done = !replay_recorder_open(&recorder, record_path, seed, state->current_level_index);
+}
+
+// Load the next recorded tick into input. Returns false (and ends playback) when the recording is over.
+static bool next_replay_tick(GameState *state, PlayerInput *input)
+{
+    ReplayTick tick;
+    if (state->current_screen == GAME_SCREEN_TITLE || !replay_player_next(&replayer, &tick))
+    {
+        replay_player_close(&replayer);
+        replaying = false;
+        *input = (PlayerInput){0};
+        return false;
+    }
+
+    // A tick recorded on the transition screen means the player moved on to the next level
+    if (state->in_level_transition)
+    {
+        game_advance_level(state);
+    }
+    state->pause_menu_active = tick.pause_menu_active;
+    *input = tick.input;
+    return true;
+}
+
+int main(int argc, char *argv[])
 {
     GameState game_state = {0};
+    const char *replay_path = NULL;
+    const char *trace_path = getenv("KNIGHT_TRACE"); // --trace takes precedence
+
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], "--record") == 0)
+            record_path = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0)
+            replay_path = argv[++i];
+        else if (strcmp(argv[i], "--trace") == 0)
+            trace_path = argv[++i];
+    }
+
+    // Timeline trace (--trace <file> or KNIGHT_TRACE=<file>); started first so asset loads are in it
+    if (trace_path && trace_path[0] != '\0')
+    {
+#ifdef KNIGHT_PROFILER
+        if (!trace_start(trace_path))
+            fprintf(stderr, "Could not open trace file '%s'\n", trace_path);
+#else
+        fprintf(stderr, "Tracing needs a build with -DKNIGHT_PROFILER=ON\n");
+#endif
+    }
 
     // Initialize asset paths
     init_asset_paths();
@@ -15,7 +87,9 @@ int main(void)
     const char *music_path = get_asset_path("fantasy-craft-loop-431346.mp3");
 
     // Use LoadMusicStream for long audio files like background music
+    TRACE_BEGIN_DETAIL("LoadMusicStream", "fantasy-craft-loop-431346.mp3");
     game_state.background_music = LoadMusicStream(music_path);
+    TRACE_END("LoadMusicStream");
 
     if (game_state.background_music.frameCount > 0)
     {
@@ -23,11 +97,25 @@ int main(void)
         PlayMusicStream(game_state.background_music);
     }
 
+    // Start straight into the recorded session when replaying
+    if (replay_path && replay_player_open(&replayer, replay_path))
+    {
+        replaying = true;
+        SetRandomSeed(replayer.seed);
+        game_start_level(&game_state, replayer.start_level);
+    }
+
     // Main game loop
     // We use game_state.running as the primary exit condition to allow ESC to be handled by our pause menu
     // However, we still check WindowShouldClose() which will be set by the window close button (X)
+    // The simulation advances in fixed SIMULATION_DT ticks so physics is identical at any frame rate;
+    // leftover time in the accumulator is used to interpolate the frame that gets drawn
+    float accumulator = 0.0f;
+    PlayerInput input = {0};
     while (game_state.running)
     {
+        PROFILE_FRAME_BEGIN();
+
         // Check if user clicked the window close button
         if (WindowShouldClose())
         {
@@ -37,16 +125,63 @@ int main(void)
         // Update music stream (required for streaming music to work)
         UpdateMusicStream(game_state.background_music);
 
-        // Update
-        game_update(&game_state);
+        // Clamp long frames (window drags, stalls under load) so the simulation does not
+        // spiral trying to catch up
+        float frame_time = GetFrameTime();
+        if (frame_time > MAX_FRAME_TIME)
+        {
+            frame_time = MAX_FRAME_TIME;
+        }
+        accumulator += frame_time;
+
+        // Update (a replay drives the simulation by itself, so menus and input are skipped)
+        if (!replaying)
+        {
+            game_update(&game_state, &input);
+            start_recording_if_needed(&game_state);
+        }
+        while (accumulator >= SIMULATION_DT)
+        {
+            if (replaying && !next_replay_tick(&game_state, &input))
+                break;
+
+            if (recorder.file && game_sim_is_active(&game_state))
+            {
+                ReplayTick tick = {input, game_state.pause_menu_active};
+                replay_recorder_write(&recorder, &tick);
+            }
+
+            TRACE_BEGIN("game_step");
+            game_step(&game_state, &input, SIMULATION_DT);
+            TRACE_END("game_step");
+            player_input_consume_presses(&input);
+            accumulator -= SIMULATION_DT;
+        }
+
+        // A recording covers one session: stop once the game is back on the title screen
+        if (recorder.file && game_state.current_screen == GAME_SCREEN_TITLE)
+        {
+            replay_recorder_close(&recorder);
+            recording_done = true;
+        }
 
         // Draw
-        game_draw(&game_state);
+        TRACE_BEGIN("game_draw");
+        game_draw(&game_state, accumulator / SIMULATION_DT);
+        TRACE_END("game_draw");
     }
 
+#ifdef KNIGHT_PROFILER
+    // Keep the last PROFILER_HISTORY frames for offline analysis
+    profiler_write_csv("profile_frames.csv");
+#endif
+
     // Cleanup
+    replay_recorder_close(&recorder);
+    replay_player_close(&replayer);
     game_cleanup(&game_state);
     UnloadMusicStream(game_state.background_music);
+    trace_stop();
 
     CloseAudioDevice();
 
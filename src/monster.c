@@ -1,19 +1,69 @@
 #include "monster.h"
-#include "asset_paths.h"
 #include "config.h"
+#include "dragon.h"
+#include "think_schedule.h"
 #include <stdlib.h>
 
+static MonsterArchetype monster_archetypes[MONSTER_ARCHETYPE_COUNT] = {
+    // texture_name, loot type, behavior, draw_hearts, custom_init, custom_cleanup
+    [MONSTER_BAT] = {"bat.png", "bat", MONSTER_BEHAVIOR_PATROL, monster_draw_hearts_default, NULL, NULL},
+    [MONSTER_SLUG] = {"monster_slug.png", "slug", MONSTER_BEHAVIOR_PATROL, monster_draw_hearts_default, NULL, NULL},
+    [MONSTER_CRAB] = {"crab.png", "bat", MONSTER_BEHAVIOR_PATROL, monster_draw_hearts_default, NULL, NULL},
+    [MONSTER_DRAGON] = {"dragon.png", "dragon", MONSTER_BEHAVIOR_DRAGON, dragon_draw_hearts, dragon_init, dragon_cleanup},
+    [MONSTER_BABY_DRAGON] = {"baby_dragon.png", "dragon", MONSTER_BEHAVIOR_PATROL, monster_draw_hearts_default, NULL, NULL},
+    [MONSTER_BOSS] = {"bat.png", "boss", MONSTER_BEHAVIOR_PATROL, monster_draw_hearts_default, NULL, NULL},
+};
+
+void monster_archetypes_load(void)
+{
+    for (int i = 0; i < MONSTER_ARCHETYPE_COUNT; i++)
+    {
+        MonsterArchetype *archetype = &monster_archetypes[i];
+        archetype->texture = texture_cache_acquire(archetype->texture_name);
+        archetype->dead_texture = texture_cache_acquire("monster_dead.png"); // Shared dead texture
+        archetype->filled_heart_texture = texture_cache_acquire("filled_heart.png");
+        archetype->empty_heart_texture = texture_cache_acquire("empty_heart.png");
+    }
+}
+
+void monster_archetypes_unload(void)
+{
+    for (int i = 0; i < MONSTER_ARCHETYPE_COUNT; i++)
+    {
+        MonsterArchetype *archetype = &monster_archetypes[i];
+        texture_cache_release(archetype->texture);
+        texture_cache_release(archetype->dead_texture);
+        texture_cache_release(archetype->filled_heart_texture);
+        texture_cache_release(archetype->empty_heart_texture);
+        archetype->texture = TEXTURE_HANDLE_INVALID;
+        archetype->dead_texture = TEXTURE_HANDLE_INVALID;
+        archetype->filled_heart_texture = TEXTURE_HANDLE_INVALID;
+        archetype->empty_heart_texture = TEXTURE_HANDLE_INVALID;
+    }
+}
+
+void monster_archetypes_bind_loot(LootSystem *system)
+{
+    for (int i = 0; i < MONSTER_ARCHETYPE_COUNT; i++)
+    {
+        monster_archetypes[i].loot_table = loot_system_get_table_or_default(system, monster_archetypes[i].type);
+    }
+}
+
+const MonsterArchetype *monster_archetype(MonsterArchetypeId id)
+{
+    return &monster_archetypes[id];
+}
+
 Monster monster_create(float x, float y, float width, float height, int max_hearts,
                        float left_bound, float right_bound, float patrol_speed,
-                       const char *texture_path, float scale, const char *type)
+                       MonsterArchetypeId archetype, float scale)
 {
     Monster m;
     m.position = (Vector2){x, y};
     m.velocity = (Vector2){patrol_speed, 0}; // Start moving right
     m.width = width;
     m.height = height;
-    m.texture = LoadTexture(get_asset_path(texture_path));
-    m.dead_texture = LoadTexture(get_asset_path("monster_dead.png")); // Load dead texture
     m.dead_texture_timer = 0.0f;
     m.scale = scale;
     m.hearts = max_hearts;
@@ -22,52 +72,15 @@ Monster monster_create(float x, float y, float width, float height, int max_hear
     m.patrol_right_bound = right_bound;
     m.patrol_speed = patrol_speed;
     m.active = true;
-    m.type = type; // Store monster type for loot lookup
-
-    // Load heart textures
-    m.filled_heart_texture = LoadTexture(get_asset_path("filled_heart.png"));
-    m.empty_heart_texture = LoadTexture(get_asset_path("empty_heart.png"));
-
-    // Initialize function pointers with defaults
-    m.draw_hearts = monster_draw_hearts_default;
-    m.custom_update = NULL;
-    m.custom_cleanup = NULL;
+    m.archetype = archetype;
     m.custom_data = NULL;
 
-    return m;
-}
-
-void monster_update(Monster *monster)
-{
-    if (!monster->active)
+    if (monster_archetypes[archetype].custom_init)
     {
-        // If monster is dead, increment dead texture timer
-        monster->dead_texture_timer += GetFrameTime();
-        return;
+        monster_archetypes[archetype].custom_init(&m);
     }
 
-    // Run custom update first if provided
-    if (monster->custom_update)
-    {
-        monster->custom_update(monster);
-        return; // If custom update is provided, skip default behavior
-    }
-
-    // Default update: patrol logic
-    // Update position based on velocity
-    monster->position.x += monster->velocity.x * GetFrameTime();
-
-    // Patrol logic - bounce back and forth at boundaries
-    if (monster->position.x <= monster->patrol_left_bound)
-    {
-        monster->position.x = monster->patrol_left_bound;
-        monster->velocity.x = monster->patrol_speed; // Move right
-    }
-    else if (monster->position.x >= monster->patrol_right_bound)
-    {
-        monster->position.x = monster->patrol_right_bound;
-        monster->velocity.x = -monster->patrol_speed; // Move left
-    }
+    return m;
 }
 
 void monster_draw_hearts_default(Monster *monster, float screen_pos_x, float screen_pos_y)
@@ -77,9 +90,14 @@ void monster_draw_hearts_default(Monster *monster, float screen_pos_x, float scr
     float heart_spacing = 28.0f;
     float total_hearts_width = (monster->max_hearts * heart_spacing) - 4.0f; // Spacing adjustment
 
+    const MonsterArchetype *archetype = &monster_archetypes[monster->archetype];
+    Sprite sprite = texture_cache_get_sprite(archetype->texture);
+    Sprite empty_heart = texture_cache_get_sprite(archetype->empty_heart_texture);
+    Sprite filled_heart = texture_cache_get_sprite(archetype->filled_heart_texture);
+
     // Calculate actual drawn dimensions of monster texture
-    float drawn_width = monster->texture.width * monster->scale;
-    float drawn_height = monster->texture.height * monster->scale;
+    float drawn_width = sprite.source.width * monster->scale;
+    float drawn_height = sprite.source.height * monster->scale;
     float monster_center_x = screen_pos_x + drawn_width / 2.0f;
     float hearts_start_x = monster_center_x - total_hearts_width / 2.0f;
     float hearts_y = screen_pos_y - drawn_height - 15.0f; // Above the monster
@@ -87,17 +105,15 @@ void monster_draw_hearts_default(Monster *monster, float screen_pos_x, float scr
     // Draw max hearts first (empty hearts)
     for (int i = 0; i < monster->max_hearts; i++)
     {
-        Rectangle source = {0, 0, (float)monster->empty_heart_texture.width, (float)monster->empty_heart_texture.height};
         Rectangle dest = {hearts_start_x + i * heart_spacing, hearts_y, heart_size, heart_size};
-        DrawTexturePro(monster->empty_heart_texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+        sprite_draw_pro(empty_heart, dest, (Vector2){0, 0}, 0.0f, WHITE);
     }
 
     // Draw current hearts on top (filled hearts)
     for (int i = 0; i < monster->hearts; i++)
     {
-        Rectangle source = {0, 0, (float)monster->filled_heart_texture.width, (float)monster->filled_heart_texture.height};
         Rectangle dest = {hearts_start_x + i * heart_spacing, hearts_y, heart_size, heart_size};
-        DrawTexturePro(monster->filled_heart_texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+        sprite_draw_pro(filled_heart, dest, (Vector2){0, 0}, 0.0f, WHITE);
     }
 }
 
@@ -112,16 +128,17 @@ void monster_draw(Monster *monster, float camera_x)
         monster->position.x - camera_x + GetScreenWidth() / 2.0f,
         monster->position.y};
 
-    Texture2D texture_to_draw = monster->texture;
+    const MonsterArchetype *archetype = &monster_archetypes[monster->archetype];
+    Sprite sprite_to_draw = texture_cache_get_sprite(archetype->texture);
 
     if (!monster->active)
     {
-        texture_to_draw = monster->dead_texture;
+        sprite_to_draw = texture_cache_get_sprite(archetype->dead_texture);
     }
 
     // Draw monster texture
-    DrawTextureEx(
-        texture_to_draw,
+    sprite_draw_ex(
+        sprite_to_draw,
         screen_pos,
         0.0f,
         monster->scale,
@@ -145,80 +162,285 @@ void monster_draw(Monster *monster, float camera_x)
     if (monster->active)
     {
         // Draw hearts using custom or default function
-        monster->draw_hearts(monster, screen_pos.x, screen_pos.y);
+        archetype->draw_hearts(monster, screen_pos.x, screen_pos.y);
     }
 }
 
-void monster_take_damage(Monster *monster, int damage)
+void monster_cleanup(Monster *monster)
 {
-    if (!monster->active)
-        return;
-
-    monster->hearts -= damage;
-    if (monster->hearts <= 0)
+    // Call custom cleanup if provided; textures belong to the archetype
+    MonsterCleanupFunc custom_cleanup = monster_archetypes[monster->archetype].custom_cleanup;
+    if (custom_cleanup)
     {
-        monster->hearts = 0;
-        monster->active = false;
+        custom_cleanup(monster);
     }
 }
 
-void monster_cleanup(Monster *monster)
+static void monster_list_reserve(MonsterList *list, int capacity)
 {
-    // Call custom cleanup if provided
-    if (monster->custom_cleanup)
-    {
-        monster->custom_cleanup(monster);
-    }
+    list->x = (float *)realloc(list->x, sizeof(float) * capacity);
+    list->previous_x = (float *)realloc(list->previous_x, sizeof(float) * capacity);
+    list->y = (float *)realloc(list->y, sizeof(float) * capacity);
+    list->velocity_x = (float *)realloc(list->velocity_x, sizeof(float) * capacity);
+    list->width = (float *)realloc(list->width, sizeof(float) * capacity);
+    list->height = (float *)realloc(list->height, sizeof(float) * capacity);
+    list->patrol = (PatrolPath *)realloc(list->patrol, sizeof(PatrolPath) * capacity);
+    list->dead_texture_timer = (float *)realloc(list->dead_texture_timer, sizeof(float) * capacity);
+    list->hearts = (int *)realloc(list->hearts, sizeof(int) * capacity);
+    list->active = (bool *)realloc(list->active, sizeof(bool) * capacity);
+    list->think_owed = (float *)realloc(list->think_owed, sizeof(float) * capacity);
+    list->think_dt = (float *)realloc(list->think_dt, sizeof(float) * capacity);
+    list->cold = (MonsterCold *)realloc(list->cold, sizeof(MonsterCold) * capacity);
+    list->capacity = capacity;
+    slot_table_reserve(&list->slots, capacity);
+}
 
-    // Unload textures
-    UnloadTexture(monster->texture);
-    UnloadTexture(monster->filled_heart_texture);
-    UnloadTexture(monster->empty_heart_texture);
+MonsterList monster_list_create(int capacity)
+{
+    MonsterList list = {0};
+    monster_list_reserve(&list, capacity > 0 ? capacity : 1);
+    return list;
 }
 
-bool monster_check_collision(Monster *monster, Rectangle player_rect)
+static void monster_batch_add(MonsterBatch *batch, int index)
 {
-    if (!monster->active)
-        return false;
+    if (batch->count >= batch->capacity)
+    {
+        batch->capacity = batch->capacity > 0 ? batch->capacity * 2 : 8;
+        batch->indices = (int *)realloc(batch->indices, sizeof(int) * batch->capacity);
+    }
+    batch->indices[batch->count++] = index;
+}
 
-    Rectangle monster_rect = {
-        monster->position.x,
-        monster->position.y,
-        monster->width,
-        monster->height};
+// Point the batch entry for from at to instead, or drop it when to is -1
+static void monster_batch_replace(MonsterBatch *batch, int from, int to)
+{
+    for (int b = 0; b < batch->count; b++)
+    {
+        if (batch->indices[b] != from)
+            continue;
 
-    return CheckCollisionRecs(monster_rect, player_rect);
+        if (to >= 0)
+        {
+            batch->indices[b] = to;
+        }
+        else
+        {
+            // Keep the batch in list order
+            batch->count--;
+            for (; b < batch->count; b++)
+            {
+                batch->indices[b] = batch->indices[b + 1];
+            }
+        }
+        return;
+    }
 }
 
-MonsterList monster_list_create(int capacity)
+SlotHandle monster_list_add(MonsterList *list, Monster monster)
 {
-    MonsterList list;
-    list.monsters = (Monster *)malloc(sizeof(Monster) * capacity);
-    list.count = 0;
-    list.capacity = capacity;
-    return list;
+    if (list->count >= list->capacity)
+    {
+        monster_list_reserve(list, list->capacity * 2);
+    }
+    monster_list_set(list, list->count, &monster);
+    list->previous_x[list->count] = monster.position.x;
+    list->think_owed[list->count] = 0.0f;
+    list->think_dt[list->count] = 0.0f;
+    monster_batch_add(&list->batches[monster_archetypes[monster.archetype].behavior], list->count);
+    return slot_table_insert(&list->slots, list->count++);
 }
 
-void monster_list_add(MonsterList *list, Monster monster)
+void monster_list_remove_at(MonsterList *list, int index)
 {
-    if (list->count < list->capacity)
+    Monster removed = monster_list_get(list, index);
+    monster_cleanup(&removed);
+
+    // The last monster moves into the hole, every array alike
+    int last = --list->count;
+    slot_table_remove(&list->slots, index, last);
+    monster_batch_replace(&list->batches[monster_archetypes[list->cold[index].archetype].behavior], index, -1);
+    if (index != last)
     {
-        list->monsters[list->count++] = monster;
+        monster_batch_replace(&list->batches[monster_archetypes[list->cold[last].archetype].behavior], last, index);
+        list->x[index] = list->x[last];
+        list->previous_x[index] = list->previous_x[last];
+        list->y[index] = list->y[last];
+        list->velocity_x[index] = list->velocity_x[last];
+        list->width[index] = list->width[last];
+        list->height[index] = list->height[last];
+        list->patrol[index] = list->patrol[last];
+        list->dead_texture_timer[index] = list->dead_texture_timer[last];
+        list->hearts[index] = list->hearts[last];
+        list->active[index] = list->active[last];
+        list->think_owed[index] = list->think_owed[last];
+        list->think_dt[index] = list->think_dt[last];
+        list->cold[index] = list->cold[last];
     }
 }
 
+bool monster_list_remove(MonsterList *list, SlotHandle handle)
+{
+    int index = slot_table_find(&list->slots, handle);
+    if (index < 0)
+        return false;
+    monster_list_remove_at(list, index);
+    return true;
+}
+
+int monster_list_find(const MonsterList *list, SlotHandle handle)
+{
+    return slot_table_find(&list->slots, handle);
+}
+
 void monster_list_cleanup(MonsterList *list)
 {
-    if (list->monsters)
+    if (list->cold)
     {
         // Cleanup each monster
         for (int i = 0; i < list->count; i++)
         {
-            monster_cleanup(&list->monsters[i]);
+            Monster monster = monster_list_get(list, i);
+            monster_cleanup(&monster);
         }
-        free(list->monsters);
-        list->monsters = NULL;
+        free(list->x);
+        free(list->previous_x);
+        free(list->y);
+        free(list->velocity_x);
+        free(list->width);
+        free(list->height);
+        free(list->patrol);
+        free(list->dead_texture_timer);
+        free(list->hearts);
+        free(list->active);
+        free(list->think_owed);
+        free(list->think_dt);
+        free(list->cold);
+        list->cold = NULL;
+    }
+    for (int b = 0; b < MONSTER_BEHAVIOR_COUNT; b++)
+    {
+        free(list->batches[b].indices);
+        list->batches[b] = (MonsterBatch){0};
     }
+    slot_table_cleanup(&list->slots);
     list->count = 0;
     list->capacity = 0;
 }
+
+Monster monster_list_get(const MonsterList *list, int index)
+{
+    const MonsterCold *cold = &list->cold[index];
+    Monster m;
+    m.position = (Vector2){list->x[index], list->y[index]};
+    m.velocity = (Vector2){list->velocity_x[index], 0};
+    m.width = list->width[index];
+    m.height = list->height[index];
+    m.dead_texture_timer = list->dead_texture_timer[index];
+    m.scale = cold->scale;
+    m.hearts = list->hearts[index];
+    m.max_hearts = cold->max_hearts;
+    m.patrol_left_bound = list->patrol[index].left_bound;
+    m.patrol_right_bound = list->patrol[index].right_bound;
+    m.patrol_speed = list->patrol[index].speed;
+    m.active = list->active[index];
+    m.archetype = cold->archetype;
+    m.custom_data = cold->custom_data;
+    return m;
+}
+
+void monster_list_set(MonsterList *list, int index, const Monster *monster)
+{
+    list->x[index] = monster->position.x;
+    list->y[index] = monster->position.y;
+    list->velocity_x[index] = monster->velocity.x;
+    list->width[index] = monster->width;
+    list->height[index] = monster->height;
+    list->patrol[index] = (PatrolPath){monster->position.x, monster->velocity.x,
+                                       monster->patrol_left_bound, monster->patrol_right_bound, monster->patrol_speed};
+    list->dead_texture_timer[index] = monster->dead_texture_timer;
+    list->hearts[index] = monster->hearts;
+    list->active[index] = monster->active;
+
+    MonsterCold *cold = &list->cold[index];
+    cold->scale = monster->scale;
+    cold->max_hearts = monster->max_hearts;
+    cold->archetype = monster->archetype;
+    cold->custom_data = monster->custom_data;
+}
+
+Rectangle monster_list_rect(const MonsterList *list, int index)
+{
+    return (Rectangle){list->x[index], list->y[index], list->width[index], list->height[index]};
+}
+
+void monster_list_take_damage(MonsterList *list, int index, int damage)
+{
+    if (!list->active[index])
+        return;
+
+    list->hearts[index] -= damage;
+    if (list->hearts[index] <= 0)
+    {
+        list->hearts[index] = 0;
+        list->active[index] = false;
+    }
+}
+
+// Patrols are closed-form, so a monster that thinks is simply evaluated at time, however long
+// it has been since it last thought. Every behavior kind patrols.
+void monster_list_update(MonsterList *list, float camera_x, double time, float delta_time)
+{
+    list->thinking = think_schedule(list->x, list->count, camera_x, list->think_tick++, delta_time,
+                                    list->think_owed, list->think_dt);
+
+    float *x = list->x;
+    float *previous_x = list->previous_x;
+    float *velocity_x = list->velocity_x;
+    float *dead_texture_timer = list->dead_texture_timer;
+    const PatrolPath *patrol = list->patrol;
+    const float *think_dt = list->think_dt;
+    const bool *active = list->active;
+
+    for (int i = 0; i < list->count; i++)
+    {
+        previous_x[i] = x[i];
+        if (active[i] && think_dt[i] > 0.0f)
+        {
+            x[i] = patrol_path_x(&patrol[i], time, &velocity_x[i]);
+        }
+
+        // Dead monsters count up towards hiding their dead texture
+        dead_texture_timer[i] = active[i] ? dead_texture_timer[i] : dead_texture_timer[i] + think_dt[i];
+    }
+}
+
+void monster_list_update_behaviors(MonsterList *list, ProjectileList *projectiles, Vector2 target_pos, TimerWheel *timers)
+{
+    // One direct loop per kind; patrol-only monsters have nothing more to do
+    dragon_batch_update(list, &list->batches[MONSTER_BEHAVIOR_DRAGON], projectiles, target_pos, timers);
+}
+
+void monster_list_restart(MonsterList *list)
+{
+    list->think_tick = 0;
+    list->thinking = 0;
+    for (int i = 0; i < list->count; i++)
+    {
+        list->x[i] = patrol_path_x(&list->patrol[i], 0.0, &list->velocity_x[i]);
+        list->previous_x[i] = list->x[i];
+        list->think_owed[i] = 0.0f;
+        list->think_dt[i] = 0.0f;
+    }
+}
+
+void monster_list_draw(const MonsterList *list, float camera_x, float alpha)
+{
+    for (int i = 0; i < list->count; i++)
+    {
+        // Blend between the last two updates, like the player (monsters only move sideways)
+        Monster monster = monster_list_get(list, i);
+        monster.position.x = list->previous_x[i] + (list->x[i] - list->previous_x[i]) * alpha;
+        monster_draw(&monster, camera_x);
+    }
+}
@@ -0,0 +1,96 @@
+#include "periodic.h"
+#include <math.h>
+
+float patrol_path_x(const PatrolPath *path, double time, float *velocity)
+{
+    double x = path->origin_x;
+    double left = path->left_bound;
+    double right = path->right_bound;
+    double first_leg; // Seconds until the first bound is reached
+    bool from_right;  // Which bound the back and forth starts from
+
+    if (x < left)
+    {
+        first_leg = 0.0;
+        from_right = false;
+    }
+    else if (x > right)
+    {
+        first_leg = 0.0;
+        from_right = true;
+    }
+    else if (path->origin_velocity > 0.0f)
+    {
+        first_leg = (right - x) / path->origin_velocity;
+        from_right = true;
+    }
+    else if (path->origin_velocity < 0.0f)
+    {
+        first_leg = (left - x) / path->origin_velocity;
+        from_right = false;
+    }
+    else
+    {
+        if (velocity)
+            *velocity = 0.0f;
+        return path->origin_x;
+    }
+
+    if (time < first_leg)
+    {
+        if (velocity)
+            *velocity = path->origin_velocity;
+        return (float)(x + path->origin_velocity * time);
+    }
+
+    double span = right - left;
+    if (span <= 0.0 || path->speed <= 0.0f)
+    {
+        if (velocity)
+            *velocity = 0.0f;
+        return (float)(from_right ? right : left);
+    }
+
+    // Distance into the current round trip, counted from the starting bound (not from the
+    // left bound, which may be very far away and would eat the precision)
+    double distance = fmod(path->speed * (time - first_leg), 2.0 * span);
+    bool second_half = distance >= span;
+    double along = second_half ? distance - span : distance;
+    bool moving_left = from_right != second_half;
+
+    if (velocity)
+        *velocity = moving_left ? -path->speed : path->speed;
+    return (float)(moving_left ? right - along : left + along);
+}
+
+float fade_cycle_opacity(const FadeCycle *cycle, double time, bool *faded_out)
+{
+    double fade_out_start = cycle->opaque_duration;
+    double faded_out_start = fade_out_start + cycle->fade_out_duration;
+    double fade_in_start = faded_out_start + cycle->faded_out_duration;
+    double period = fade_in_start + cycle->fade_in_duration;
+
+    double t = period > 0.0 ? fmod(time, period) : 0.0;
+
+    if (t < fade_out_start || period <= 0.0)
+    {
+        // Fully opaque phase
+        *faded_out = false;
+        return 1.0f;
+    }
+    if (t < faded_out_start)
+    {
+        // Fading out phase
+        *faded_out = true;
+        return (float)(1.0 - (t - fade_out_start) / cycle->fade_out_duration);
+    }
+    if (t < fade_in_start)
+    {
+        // Fully faded out phase
+        *faded_out = true;
+        return 0.0f;
+    }
+    // Fading in phase
+    *faded_out = false;
+    return (float)((t - fade_in_start) / cycle->fade_in_duration);
+}
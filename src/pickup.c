@@ -1,14 +1,18 @@
 #include "pickup.h"
-#include "asset_paths.h"
+#include "config.h"
 #include <stdlib.h>
 #include <math.h>
 
-// Generic pickup creation function that handles different types
-Pickup pickup_create(PickupType type, Vector2 spawn_pos, int value)
+// Pickups pop up in an arc and despawn once they fall back below ground level
+static const BodyKind pickup_body_kind = {300.0f, 5.0f, INFINITY, 700.0f};
+
+// Starting state for a pickup of the given type; the texture is left to the caller
+static Pickup pickup_init(PickupType type, Vector2 spawn_pos, int value)
 {
     Pickup p = {0};
 
     p.position = spawn_pos;
+    p.previous_position = spawn_pos;
     p.velocity = (Vector2){0, -300.0f}; // Move straight upward
     p.speed = 300.0f;
     p.type = type;
@@ -17,61 +21,31 @@ Pickup pickup_create(PickupType type, Vector2 spawn_pos, int value)
     p.max_lifetime = 15.0f;
     p.rotation = 0.0f;
     p.value = value;
+    p.spawner = -1;
 
-    // Type-specific configuration
-    switch (type)
-    {
-    case PICKUP_FIREBALL:
-        p.width = 16.0f;
-        p.height = 16.0f;
-        p.texture = LoadTexture(get_asset_path("fireball.png"));
-        p.scale = 0.04f;
-        break;
-    default:
-        p.width = 16.0f;
-        p.height = 16.0f;
-        p.scale = 0.04f;
-        break;
-    }
+    // Every type is the same size so far
+    p.width = 16.0f;
+    p.height = 16.0f;
+    p.scale = 0.04f;
 
     return p;
 }
 
-void pickup_update(Pickup *pickup)
+// Generic pickup creation function that handles different types
+Pickup pickup_create(PickupType type, Vector2 spawn_pos, int value)
 {
-    if (!pickup->active)
-        return;
-
-    // Apply gravity to simulate arc trajectory (bubble popping up then falling)
-    float gravity = 300.0f; // Gravity constant
-    pickup->velocity.y += gravity * GetFrameTime();
-
-    // Update position based on velocity
-    pickup->position.x += pickup->velocity.x * GetFrameTime();
-    pickup->position.y += pickup->velocity.y * GetFrameTime();
-
-    // Update rotation for visual effect
-    pickup->rotation += 5.0f * GetFrameTime();
+    Pickup p = pickup_init(type, spawn_pos, value);
 
-    // Update lifetime
-    pickup->lifetime -= GetFrameTime();
-    if (pickup->lifetime <= 0.0f)
-    {
-        pickup->active = false;
-    }
-
-    // Despawn if projectile goes too far off screen
-    float screen_x = pickup->position.x - GetScreenWidth() / 2.0f;
-    if (screen_x < -1000.0f || screen_x > GetScreenWidth() + 1000.0f)
+    switch (type)
     {
-        pickup->active = false;
+    case PICKUP_FIREBALL:
+        p.texture = texture_cache_acquire("fireball.png");
+        break;
+    default:
+        break;
     }
 
-    // Despawn if falls back to ground level or below
-    if (pickup->position.y > 700.0f)
-    {
-        pickup->active = false;
-    }
+    return p;
 }
 
 void pickup_draw(Pickup *pickup, float camera_x)
@@ -91,48 +65,145 @@ void pickup_draw(Pickup *pickup, float camera_x)
     screen_pos.y -= scaled_height / 2.0f;
 
     // Draw pickup with rotation
-    DrawTextureEx(
-        pickup->texture,
+    sprite_draw_ex(
+        texture_cache_get_sprite(pickup->texture),
         screen_pos,
         pickup->rotation,
         pickup->scale,
         WHITE);
 }
 
-PickupList pickup_list_create(int capacity)
+// Every stored pickup holds a texture reference, active or not
+static void pickup_release(Pickup *pickup)
 {
-    PickupList list;
-    list.pickups = (Pickup *)malloc(sizeof(Pickup) * capacity);
-    list.count = 0;
-    list.capacity = capacity;
-    return list;
+    texture_cache_release(pickup->texture);
 }
 
-void pickup_list_add(PickupList *list, Pickup pickup)
+SLOT_MAP_DEFINE(PickupList, Pickup, pickups, pickup_list, SLOT_MAP_NO_HOOK, pickup_release)
+
+int pickup_list_update(PickupList *list, BodyBatch *bodies, const SectorWindow *awake, float camera_x, float delta_time)
 {
-    if (list->count < list->capacity)
+    // Integrate every awake pickup in one batch, then copy the results back
+    int frozen = 0;
+    body_batch_begin(bodies, list->count);
+    for (int i = 0; i < list->count; i++)
     {
-        list->pickups[list->count++] = pickup;
+        Pickup *pickup = &list->pickups[i];
+        if (!pickup->active)
+            continue;
+
+        if (sector_window_contains(awake, pickup->position.x))
+            body_batch_add(bodies, i, pickup->position, pickup->velocity, pickup->rotation, pickup->lifetime, false);
+        else
+            frozen++;
+    }
+    body_batch_integrate(bodies, &pickup_body_kind, camera_x, delta_time);
+
+    for (int b = 0; b < bodies->count; b++)
+    {
+        Pickup *pickup = &list->pickups[bodies->source[b]];
+        pickup->previous_position = pickup->position;
+        pickup->position = (Vector2){bodies->x[b], bodies->y[b]};
+        pickup->velocity.y = bodies->velocity_y[b];
+        pickup->rotation = bodies->rotation[b];
+        pickup->lifetime = bodies->lifetime[b];
+    }
+    for (int e = 0; e < bodies->expired_count; e++)
+    {
+        list->pickups[bodies->expired[e]].active = false;
     }
+    return frozen;
 }
 
-void pickup_list_cleanup(PickupList *list)
+void pickup_list_recycle(PickupList *list, PickupSpawnerList *spawners, PickupPool *pool)
 {
-    if (list->pickups)
+    for (int i = 0; i < list->count;)
     {
-        // Unload textures for each pickup
-        for (int i = 0; i < list->count; i++)
+        Pickup *pickup = &list->pickups[i];
+        if (pickup->active)
         {
-            if (list->pickups[i].active)
-            {
-                UnloadTexture(list->pickups[i].texture);
-            }
+            i++;
+            continue;
+        }
+
+        if (pickup->spawner >= 0 && pickup->spawner < spawners->count)
+        {
+            spawners->spawners[pickup->spawner].live_count--;
+        }
+
+        // The texture reference moves to the pool along with the pickup
+        pickup_pool_put(pool, *pickup);
+        pickup->texture = TEXTURE_HANDLE_INVALID;
+        pickup_list_remove_at(list, i);
+    }
+}
+
+// ============ POOL FUNCTIONS ============
+
+PickupPool pickup_pool_create(int capacity)
+{
+    PickupPool pool;
+    pool.pickups = (Pickup *)malloc(sizeof(Pickup) * (capacity > 0 ? capacity : 1));
+    pool.count = 0;
+    pool.capacity = capacity;
+    return pool;
+}
+
+void pickup_pool_cleanup(PickupPool *pool)
+{
+    if (pool->pickups)
+    {
+        for (int i = 0; i < pool->count; i++)
+        {
+            texture_cache_release(pool->pickups[i].texture);
+        }
+        free(pool->pickups);
+        pool->pickups = NULL;
+    }
+    pool->count = 0;
+    pool->capacity = 0;
+}
+
+void pickup_pool_put(PickupPool *pool, Pickup pickup)
+{
+    if (pool->count >= pool->capacity)
+    {
+        pool->capacity = pool->capacity > 0 ? pool->capacity * 2 : 8;
+        pool->pickups = (Pickup *)realloc(pool->pickups, sizeof(Pickup) * pool->capacity);
+    }
+    pool->pickups[pool->count++] = pickup;
+}
+
+Pickup pickup_pool_take(PickupPool *pool, PickupType type, Vector2 spawn_pos, int value)
+{
+    // Most recently pooled first; the pool is unordered, so the last one fills the gap
+    for (int i = pool->count - 1; i >= 0; i--)
+    {
+        if (pool->pickups[i].type != type)
+            continue;
+
+        Pickup p = pickup_init(type, spawn_pos, value);
+        p.texture = pool->pickups[i].texture;
+        pool->pickups[i] = pool->pickups[--pool->count];
+        return p;
+    }
+
+    return pickup_create(type, spawn_pos, value);
+}
+
+void pickup_pool_prewarm(PickupPool *pool, PickupSpawnerList *spawners)
+{
+    for (int i = 0; i < spawners->count; i++)
+    {
+        PickupSpawner *spawner = &spawners->spawners[i];
+        if (!spawner->prewarm)
+            continue;
+
+        for (int n = 0; n < spawner->max_live; n++)
+        {
+            pickup_pool_put(pool, pickup_create(spawner->type, spawner->spawn_location, spawner->value));
         }
-        free(list->pickups);
-        list->pickups = NULL;
     }
-    list->count = 0;
-    list->capacity = 0;
 }
 // Spawner functions
 PickupSpawner pickup_spawner_create(PickupType type, Vector2 location, int value, float interval)
@@ -142,8 +213,11 @@ PickupSpawner pickup_spawner_create(PickupType type, Vector2 location, int value
     spawner.spawn_location = location;
     spawner.value = value;
     spawner.spawn_interval = interval;
-    spawner.spawn_timer = interval; // Start ready to spawn
+    spawner.spawn_timer = TIMER_HANDLE_NONE; // Started with pickup_spawner_list_restart
     spawner.enabled = true;
+    spawner.max_live = PICKUP_SPAWNER_DEFAULT_MAX_LIVE;
+    spawner.live_count = 0;
+    spawner.prewarm = true;
     return spawner;
 }
 
@@ -175,17 +249,40 @@ void pickup_spawner_list_cleanup(PickupSpawnerList *list)
     list->capacity = 0;
 }
 
-void pickup_spawner_update(PickupSpawner *spawner, PickupList *pickup_list)
+int pickup_spawner_list_update(PickupSpawnerList *spawners, PickupList *pickup_list, PickupPool *pool, TimerWheel *timers,
+                               const SectorWindow *awake)
 {
-    if (!spawner->enabled)
-        return;
+    int sleeping = 0;
+    for (int i = 0; i < spawners->count; i++)
+    {
+        PickupSpawner *spawner = &spawners->spawners[i];
+        if (!spawner->enabled)
+            continue;
+        if (!sector_window_contains(awake, spawner->spawn_location.x))
+        {
+            sleeping++;
+            continue;
+        }
+
+        // A due spawner with no room waits until one of its pickups is gone
+        if (!timer_wheel_pending(timers, spawner->spawn_timer) && spawner->live_count < spawner->max_live)
+        {
+            // Reuse a pooled pickup based on the spawner type
+            Pickup pickup = pickup_pool_take(pool, spawner->type, spawner->spawn_location, spawner->value);
+            pickup.spawner = i;
+            pickup_list_add(pickup_list, pickup);
+            spawner->live_count++;
+            spawner->spawn_timer = timer_wheel_schedule(timers, timer_ticks(spawner->spawn_interval), NULL, NULL, 0);
+        }
+    }
+    return sleeping;
+}
 
-    spawner->spawn_timer -= GetFrameTime();
-    if (spawner->spawn_timer <= 0.0f)
+void pickup_spawner_list_restart(PickupSpawnerList *spawners, TimerWheel *timers)
+{
+    for (int i = 0; i < spawners->count; i++)
     {
-        // Create and add the pickup based on the spawner type
-        Pickup pickup = pickup_create(spawner->type, spawner->spawn_location, spawner->value);
-        pickup_list_add(pickup_list, pickup);
-        spawner->spawn_timer = spawner->spawn_interval; // Reset timer
+        PickupSpawner *spawner = &spawners->spawners[i];
+        timer_wheel_restart(timers, &spawner->spawn_timer, timer_ticks(spawner->spawn_interval), NULL, NULL, 0);
     }
-}
\ No newline at end of file
+}
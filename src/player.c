@@ -2,56 +2,70 @@
 #include "damage.h"
 #include "hazard.h"
 #include "config.h"
-#include "asset_paths.h"
 #include "loot.h"
 #include <stddef.h>
 
+// Timer callbacks (context is the player)
+static void damage_display_over(void *context, int arg)
+{
+    (void)arg;
+    ((Player *)context)->active_damage_type = DAMAGE_TYPE_NONE;
+}
+
+static void protection_potion_over(void *context, int arg)
+{
+    (void)arg;
+    ((Player *)context)->protection_potion_active = false;
+}
+
 Player player_create(float x, float y)
 {
     Player p;
     p.position = (Vector2){x, y};
+    p.previous_position = p.position;
     p.velocity = (Vector2){0, 0};
     p.speed = 200.0f;
     p.jump_power = 400.0f;
     p.is_jumping = false;
 
     // Load character texture
-    p.texture = LoadTexture(get_asset_path("character.png"));
-    p.flipleft_texture = LoadTexture(get_asset_path("character_flipleft.png"));
-    p.hurt_texture = LoadTexture(get_asset_path("character_hurt.png"));
-    p.hurt_flipleft_texture = LoadTexture(get_asset_path("character_hurt_flipleft.png"));
-    p.on_fire_texture = LoadTexture(get_asset_path("character_on_fire.png"));
-    p.on_fire_flipleft_texture = LoadTexture(get_asset_path("character_on_fire_flipleft.png"));
-    p.dust_texture = LoadTexture(get_asset_path("blood_sand.png"));
-    p.dust_flipleft_texture = LoadTexture(get_asset_path("blood_sand_flipleft.png"));
-    p.sword_texture = LoadTexture(get_asset_path("sword.png"));
-    p.sword_flipleft_texture = LoadTexture(get_asset_path("sword_flipleft.png"));
-    p.ducking_texture = LoadTexture(get_asset_path("dodging_character.png"));
-    p.ducking_flipleft_texture = LoadTexture(get_asset_path("dodging_character_flipleft.png"));
+    p.texture = texture_cache_acquire("character.png");
+    p.flipleft_texture = texture_cache_acquire("character_flipleft.png");
+    p.hurt_texture = texture_cache_acquire("character_hurt.png");
+    p.hurt_flipleft_texture = texture_cache_acquire("character_hurt_flipleft.png");
+    p.on_fire_texture = texture_cache_acquire("character_on_fire.png");
+    p.on_fire_flipleft_texture = texture_cache_acquire("character_on_fire_flipleft.png");
+    p.dust_texture = texture_cache_acquire("blood_sand.png");
+    p.dust_flipleft_texture = texture_cache_acquire("blood_sand_flipleft.png");
+    p.sword_texture = texture_cache_acquire("sword.png");
+    p.sword_flipleft_texture = texture_cache_acquire("sword_flipleft.png");
+    p.ducking_texture = texture_cache_acquire("dodging_character.png");
+    p.ducking_flipleft_texture = texture_cache_acquire("dodging_character_flipleft.png");
     p.sword_hitbox = (Rectangle){0, 0, 20, 40}; // Example sword hitbox size
     p.scale = 0.06f;                            // Scale down smaller
-    p.width = (float)p.texture.width * p.scale;
-    p.height = (float)p.texture.height * p.scale;
+    Sprite base_sprite = texture_cache_get_sprite(p.texture);
+    p.width = base_sprite.source.width * p.scale;
+    p.height = base_sprite.source.height * p.scale;
 
     // Load dead texture (optional - create a simple fallback if file doesn't exist)
-    p.dead_texture = LoadTexture(get_asset_path("dead_character.png"));
+    p.dead_texture = texture_cache_acquire("dead_character.png");
 
     // Load heart textures
-    p.filled_heart_texture = LoadTexture(get_asset_path("filled_heart.png"));
-    p.empty_heart_texture = LoadTexture(get_asset_path("empty_heart.png"));
+    p.filled_heart_texture = texture_cache_acquire("filled_heart.png");
+    p.empty_heart_texture = texture_cache_acquire("empty_heart.png");
 
     // Load fireball texture for inventory display
-    p.fireball_texture = LoadTexture(get_asset_path("fireball.png"));
+    p.fireball_texture = texture_cache_acquire("fireball.png");
 
     // Load protection potion texture for inventory display
-    p.protection_potion_texture = LoadTexture(get_asset_path("protection_potion.png"));
+    p.protection_potion_texture = texture_cache_acquire("protection_potion.png");
 
     // Initialize health
     p.hearts = INITIAL_HEARTS;
     p.max_hearts = MAX_HEARTS;
     p.is_dead = false;
     p.active_damage_type = DAMAGE_TYPE_NONE;
-    p.damage_timer = 0.0f;
+    p.damage_timer = TIMER_HANDLE_NONE;
 
     // Initialize projectile inventory
     p.projectile_inventory = 0; // Start with 0 projectiles
@@ -65,7 +79,7 @@ Player player_create(float x, float y)
 
     // Initialize protection potion state
     p.protection_potion_active = false;
-    p.protection_potion_timer = 0.0f;
+    p.protection_potion_timer = TIMER_HANDLE_NONE;
 
     // Initialize inventory system
     p.inventory = inventory_create();
@@ -75,15 +89,15 @@ Player player_create(float x, float y)
     return p;
 }
 
-void player_handle_input(Player *player)
+void player_handle_input(Player *player, const PlayerInput *input, TimerWheel *timers)
 {
     // Horizontal movement
-    if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT))
+    if (input->move_left)
     {
         player->velocity.x = -player->speed;
         player->facing_direction = -1; // Facing left
     }
-    else if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT))
+    else if (input->move_right)
     {
         player->velocity.x = player->speed;
         player->facing_direction = 1; // Facing right
@@ -93,7 +107,7 @@ void player_handle_input(Player *player)
         player->velocity.x = 0;
     }
 
-    if (IsKeyDown(KEY_LEFT_SHIFT))
+    if (input->sword)
     {
         player->is_using_sword = true;
     }
@@ -101,7 +115,7 @@ void player_handle_input(Player *player)
     {
         player->is_using_sword = false;
     }
-    if (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN))
+    if (input->duck)
     {
         player->is_ducking = true;
     }
@@ -111,14 +125,14 @@ void player_handle_input(Player *player)
     }
 
     // Jumping
-    if ((IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_W) || IsKeyPressed(KEY_UP)) && !player->is_jumping && !player->is_ducking)
+    if (input->jump && !player->is_jumping && !player->is_ducking)
     {
         player->velocity.y = -player->jump_power;
         player->is_jumping = true;
     }
 
-    // Use health potion with 'H' key
-    if (IsKeyPressed(KEY_H))
+    // Use health potion
+    if (input->use_health_potion)
     {
         if (player->hearts < player->max_hearts)
         {
@@ -129,44 +143,24 @@ void player_handle_input(Player *player)
         }
     }
 
-    // Use protection potion with 'P' key
-    if (IsKeyPressed(KEY_P))
+    // Use protection potion
+    if (input->use_protection_potion)
     {
         if (!player->protection_potion_active)
         {
             if (inventory_remove_loot(&player->inventory, PROTECTION_POTION, 1))
             {
                 player->protection_potion_active = true;
-                player->protection_potion_timer = PROTECTION_POTION_DURATION;
+                timer_wheel_restart(timers, &player->protection_potion_timer, timer_ticks(PROTECTION_POTION_DURATION),
+                                    protection_potion_over, player, 0);
             }
         }
     }
 }
 
-void player_update(Player *player)
+void player_update(Player *player, float delta_time)
 {
-    float delta_time = GetFrameTime();
-
-    // Update damage timer
-    if (player->active_damage_type != DAMAGE_TYPE_NONE)
-    {
-        player->damage_timer -= delta_time;
-        if (player->damage_timer <= 0.0f)
-        {
-            player->active_damage_type = DAMAGE_TYPE_NONE;
-        }
-    }
-
-    // Update protection potion timer
-    if (player->protection_potion_active)
-    {
-        player->protection_potion_timer -= delta_time;
-        if (player->protection_potion_timer <= 0.0f)
-        {
-            player->protection_potion_active = false;
-            player->protection_potion_timer = 0.0f;
-        }
-    }
+    // The damage effect and protection potion end on their timers (world timers)
 
     // Apply gravity
     player->velocity.y += GRAVITY * delta_time;
@@ -184,20 +178,8 @@ void player_update(Player *player)
     }
 }
 
-void player_update_with_hazards(Player *player, const void *hazard_list)
+void player_update_with_hazards(Player *player, const void *hazard_list, float delta_time)
 {
-    float delta_time = GetFrameTime();
-
-    // Update damage timer
-    if (player->active_damage_type != DAMAGE_TYPE_NONE)
-    {
-        player->damage_timer -= delta_time;
-        if (player->damage_timer <= 0.0f)
-        {
-            player->active_damage_type = DAMAGE_TYPE_NONE;
-        }
-    }
-
     // Apply gravity
     player->velocity.y += GRAVITY * delta_time;
 
@@ -254,21 +236,23 @@ void player_update_sword_hitbox(Player *player)
     if (player->is_using_sword)
     {
         float sword_scale = player->scale * 1.5;
+        Rectangle sword_source = texture_cache_get_sprite(player->sword_texture).source;
+        Rectangle sword_flipleft_source = texture_cache_get_sprite(player->sword_flipleft_texture).source;
         if (player->facing_direction == 1)
         {
             player->sword_hitbox = (Rectangle){
                 player->position.x + player->width * 0.5f,
                 player->position.y + player->height * 0.3f,
-                player->sword_texture.width * sword_scale,
-                player->sword_texture.height * sword_scale};
+                sword_source.width * sword_scale,
+                sword_source.height * sword_scale};
         }
         else
         {
             player->sword_hitbox = (Rectangle){
-                player->position.x - player->width * 0.5f - player->sword_flipleft_texture.width * sword_scale,
+                player->position.x - player->width * 0.5f - sword_flipleft_source.width * sword_scale,
                 player->position.y + player->height * 0.3f,
-                player->sword_flipleft_texture.width * sword_scale,
-                player->sword_flipleft_texture.height * sword_scale};
+                sword_flipleft_source.width * sword_scale,
+                sword_flipleft_source.height * sword_scale};
         }
     }
 }
@@ -281,34 +265,36 @@ void player_draw(Player *player, float camera_x)
         player->position.y};
 
     // Choose texture based on alive/dead state and damage type
-    Texture2D texture_to_draw = player->texture;
+    Sprite base_sprite = texture_cache_get_sprite(player->texture);
+    Sprite sprite_to_draw = base_sprite;
     float draw_scale = player->scale;
 
     // set default player height
-    player->height = (float)player->texture.height * player->scale;
+    player->height = base_sprite.source.height * player->scale;
 
     if (player->is_dead)
     {
-        texture_to_draw = player->dead_texture;
+        Sprite dead_sprite = texture_cache_get_sprite(player->dead_texture);
+        sprite_to_draw = dead_sprite;
         draw_scale = player->scale * 1.5f; // Draw dead texture 1.5x larger
         // Fallback to alive texture if dead texture isn't loaded
-        if (player->dead_texture.id == 0)
+        if (dead_sprite.texture.id == 0)
         {
-            texture_to_draw = player->texture;
+            sprite_to_draw = base_sprite;
         }
         else
         {
             // Adjust Y position so dead texture sits on ground instead of floating
-            float original_height = (float)player->texture.height * player->scale;
-            float dead_height = (float)player->dead_texture.height * draw_scale;
+            float original_height = base_sprite.source.height * player->scale;
+            float dead_height = dead_sprite.source.height * draw_scale;
             screen_pos.y -= (dead_height - original_height);
         }
     }
     else if (player->active_damage_type != DAMAGE_TYPE_NONE)
     {
         // Use damage-type-specific texture
-        Texture2D damage_texture;
-        Texture2D damage_flipleft_texture;
+        TextureHandle damage_texture;
+        TextureHandle damage_flipleft_texture;
         float damage_scale = player->scale;
 
         // Get display properties for this damage type
@@ -341,21 +327,21 @@ void player_draw(Player *player, float camera_x)
         // Choose direction-specific texture
         if (player->facing_direction == -1)
         {
-            texture_to_draw = damage_flipleft_texture;
-            if (texture_to_draw.id == 0)
+            sprite_to_draw = texture_cache_get_sprite(damage_flipleft_texture);
+            if (sprite_to_draw.texture.id == 0)
             {
-                texture_to_draw = damage_texture;
+                sprite_to_draw = texture_cache_get_sprite(damage_texture);
             }
         }
         else
         {
-            texture_to_draw = damage_texture;
+            sprite_to_draw = texture_cache_get_sprite(damage_texture);
         }
 
         // Fallback to neutral texture if damage texture isn't loaded
-        if (texture_to_draw.id == 0)
+        if (sprite_to_draw.texture.id == 0)
         {
-            texture_to_draw = player->facing_direction == -1 ? player->flipleft_texture : player->texture;
+            sprite_to_draw = player->facing_direction == -1 ? texture_cache_get_sprite(player->flipleft_texture) : base_sprite;
         }
         else
         {
@@ -363,8 +349,8 @@ void player_draw(Player *player, float camera_x)
 
             // Adjust Y position so bottom remains on ground
             // Use damage-specific y_offset from display properties
-            float original_height = (float)player->texture.height * player->scale;
-            float damage_height = (float)texture_to_draw.height * draw_scale;
+            float original_height = base_sprite.source.height * player->scale;
+            float damage_height = sprite_to_draw.source.height * draw_scale;
             float height_difference = damage_height - original_height;
             screen_pos.y -= (height_difference * (1.0f + display_props.y_offset));
         }
@@ -372,22 +358,23 @@ void player_draw(Player *player, float camera_x)
     else if (player->is_ducking)
     {
 
+        Sprite ducking_sprite = texture_cache_get_sprite(player->ducking_texture);
         draw_scale = player->scale * 1.3f; // Draw ducking texture 1.5x larger
         if (player->facing_direction == 1)
         {
-            texture_to_draw = player->ducking_texture;
+            sprite_to_draw = ducking_sprite;
         }
         else
         {
-            texture_to_draw = player->ducking_flipleft_texture;
-            if (texture_to_draw.id == 0)
+            sprite_to_draw = texture_cache_get_sprite(player->ducking_flipleft_texture);
+            if (sprite_to_draw.texture.id == 0)
             {
-                texture_to_draw = player->ducking_texture;
+                sprite_to_draw = ducking_sprite;
             }
         }
         // // Adjust Y position so ducking texture sits on ground instead of floating
         // float original_height = (float)player->texture.height * player->scale;
-        float ducking_height = (float)player->ducking_texture.height * draw_scale;
+        float ducking_height = ducking_sprite.source.height * draw_scale;
         // screen_pos.y -= (ducking_height - original_height);
 
         // adjust player height for ducking
@@ -396,10 +383,10 @@ void player_draw(Player *player, float camera_x)
     else if (player->facing_direction == -1)
     {
         // Use flipped texture when facing left
-        texture_to_draw = player->flipleft_texture;
-        if (player->flipleft_texture.id == 0)
+        sprite_to_draw = texture_cache_get_sprite(player->flipleft_texture);
+        if (sprite_to_draw.texture.id == 0)
         {
-            texture_to_draw = player->texture;
+            sprite_to_draw = base_sprite;
         }
     }
 
@@ -410,8 +397,8 @@ void player_draw(Player *player, float camera_x)
         draw_color = BLUE;
     }
 
-    DrawTextureEx(
-        texture_to_draw,
+    sprite_draw_ex(
+        sprite_to_draw,
         screen_pos,
         0.0f,
         draw_scale,
@@ -421,7 +408,7 @@ void player_draw(Player *player, float camera_x)
     if (player->is_using_sword)
     {
         Vector2 sword_pos = screen_pos;
-        Texture2D sword_texture_to_draw = player->sword_texture;
+        TextureHandle sword_texture_to_draw = player->sword_texture;
         float sword_scale = player->scale * 1.5;
         // Adjust sword position based on facing direction
         sword_pos.y += player->height * 0.3f; // Slightly above player's center
@@ -435,8 +422,8 @@ void player_draw(Player *player, float camera_x)
             sword_texture_to_draw = player->sword_flipleft_texture;
         }
 
-        DrawTextureEx(
-            sword_texture_to_draw,
+        sprite_draw_ex(
+            texture_cache_get_sprite(sword_texture_to_draw),
             sword_pos,
             0.0f,
             player->scale,
@@ -459,9 +446,8 @@ void player_take_damage(Player *player, int damage)
     // Check if protection potion is active
     if (player->protection_potion_active)
     {
-        // Protection potion prevents this hit and is consumed
+        // Protection potion prevents this hit and is consumed (its timer is restarted by the next one)
         player->protection_potion_active = false;
-        player->protection_potion_timer = 0.0f;
         return;
     }
 
@@ -475,19 +461,19 @@ void player_take_damage(Player *player, int damage)
     }
 }
 
-void player_apply_damage_type(Player *player, DamageType damage_type, float duration)
+void player_apply_damage_type(Player *player, TimerWheel *timers, DamageType damage_type, float duration)
 {
     if (player->is_dead)
         return;
 
     player->active_damage_type = damage_type;
-    player->damage_timer = duration;
+    timer_wheel_restart(timers, &player->damage_timer, timer_ticks(duration), damage_display_over, player, 0);
 }
 
-void player_clear_damage_type(Player *player)
+void player_clear_damage_type(Player *player, TimerWheel *timers)
 {
     player->active_damage_type = DAMAGE_TYPE_NONE;
-    player->damage_timer = 0.0f;
+    timer_wheel_cancel(timers, player->damage_timer);
 }
 
 void player_heal(Player *player, int amount)
@@ -506,52 +492,30 @@ void player_heal(Player *player, int amount)
 
 void player_cleanup(Player *player)
 {
-    UnloadTexture(player->texture);
-    if (player->flipleft_texture.id > 0)
-    {
-        UnloadTexture(player->flipleft_texture);
-    }
-    if (player->hurt_texture.id > 0)
-    {
-        UnloadTexture(player->hurt_texture);
-    }
-    if (player->hurt_flipleft_texture.id > 0)
-    {
-        UnloadTexture(player->hurt_flipleft_texture);
-    }
-    if (player->on_fire_texture.id > 0)
-    {
-        UnloadTexture(player->on_fire_texture);
-    }
-    if (player->on_fire_flipleft_texture.id > 0)
-    {
-        UnloadTexture(player->on_fire_flipleft_texture);
-    }
-    if (player->dust_texture.id > 0)
-    {
-        UnloadTexture(player->dust_texture);
-    }
-    if (player->dust_flipleft_texture.id > 0)
-    {
-        UnloadTexture(player->dust_flipleft_texture);
-    }
-    if (player->dead_texture.id > 0)
-    {
-        UnloadTexture(player->dead_texture);
-    }
-    if (player->ducking_texture.id > 0)
-    {
-        UnloadTexture(player->ducking_texture);
-    }
-    if (player->ducking_flipleft_texture.id > 0)
-    {
-        UnloadTexture(player->ducking_flipleft_texture);
-    }
-    UnloadTexture(player->filled_heart_texture);
-    UnloadTexture(player->empty_heart_texture);
-    UnloadTexture(player->fireball_texture);
-    if (player->protection_potion_texture.id > 0)
-    {
-        UnloadTexture(player->protection_potion_texture);
+    inventory_cleanup(&player->inventory);
+
+    // Release all texture references acquired in player_create
+    TextureHandle textures[] = {
+        player->texture,
+        player->flipleft_texture,
+        player->hurt_texture,
+        player->hurt_flipleft_texture,
+        player->on_fire_texture,
+        player->on_fire_flipleft_texture,
+        player->dust_texture,
+        player->dust_flipleft_texture,
+        player->dead_texture,
+        player->filled_heart_texture,
+        player->empty_heart_texture,
+        player->fireball_texture,
+        player->sword_texture,
+        player->sword_flipleft_texture,
+        player->ducking_texture,
+        player->ducking_flipleft_texture,
+        player->protection_potion_texture};
+
+    for (size_t i = 0; i < sizeof(textures) / sizeof(textures[0]); i++)
+    {
+        texture_cache_release(textures[i]);
     }
 }
@@ -0,0 +1,26 @@
+#include "player_input.h"
+
+void player_input_accumulate(PlayerInput *pending, PlayerInput frame)
+{
+    pending->move_left = frame.move_left;
+    pending->move_right = frame.move_right;
+    pending->duck = frame.duck;
+    pending->sword = frame.sword;
+
+    pending->jump = pending->jump || frame.jump;
+    pending->use_health_potion = pending->use_health_potion || frame.use_health_potion;
+    pending->use_protection_potion = pending->use_protection_potion || frame.use_protection_potion;
+    if (frame.fire)
+    {
+        pending->fire = true;
+        pending->fire_target = frame.fire_target;
+    }
+}
+
+void player_input_consume_presses(PlayerInput *input)
+{
+    input->jump = false;
+    input->use_health_potion = false;
+    input->use_protection_potion = false;
+    input->fire = false;
+}
@@ -0,0 +1,103 @@
+#include "profiler.h"
+#include "sim_clock.h"
+#include "trace.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *zone_names[PROFILE_ZONE_COUNT] = {
+    "input",
+    "hazards",
+    "player",
+    "monsters",
+    "dragon_ai",
+    "projectiles",
+    "pickups",
+    "broadphase",
+    "narrow_phase",
+    "resolve",
+    "events",
+    "draw_background",
+    "draw_entities",
+    "draw_ui",
+    "present"};
+
+static ProfileFrame frames[PROFILER_HISTORY];
+static int current = 0;          // Slot being filled
+static int completed = 0;        // Finished frames in the ring (up to PROFILER_HISTORY)
+static unsigned long long frame_start = 0;
+
+void profiler_frame_begin(void)
+{
+    unsigned long long now = sim_clock_ns();
+    if (frame_start != 0)
+    {
+        trace_end("frame");
+        frames[current].frame_ns = now - frame_start;
+        current = (current + 1) % PROFILER_HISTORY;
+        if (completed < PROFILER_HISTORY)
+            completed++;
+    }
+    memset(&frames[current], 0, sizeof(ProfileFrame));
+    frame_start = now;
+    trace_begin("frame", NULL);
+}
+
+unsigned long long profiler_zone_begin(ProfileZone zone)
+{
+    trace_begin(zone_names[zone], NULL);
+    return sim_clock_ns();
+}
+
+void profiler_zone_end(ProfileZone zone, unsigned long long start)
+{
+    frames[current].zone_ns[zone] += sim_clock_ns() - start;
+    trace_end(zone_names[zone]);
+}
+
+const ProfileFrame *profiler_frame(int frames_ago)
+{
+    if (frames_ago < 0 || frames_ago >= completed)
+        return NULL;
+    int index = (current - 1 - frames_ago + PROFILER_HISTORY) % PROFILER_HISTORY;
+    return &frames[index];
+}
+
+int profiler_frame_count(void)
+{
+    return completed;
+}
+
+const char *profiler_zone_name(ProfileZone zone)
+{
+    if (zone < 0 || zone >= PROFILE_ZONE_COUNT)
+        return "unknown";
+    return zone_names[zone];
+}
+
+bool profiler_write_csv(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (!file)
+        return false;
+
+    fprintf(file, "frame,frame_ms");
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++)
+    {
+        fprintf(file, ",%s_ms", zone_names[zone]);
+    }
+    fprintf(file, "\n");
+
+    for (int i = completed - 1; i >= 0; i--)
+    {
+        const ProfileFrame *frame = profiler_frame(i);
+        fprintf(file, "%d,%.4f", completed - 1 - i, frame->frame_ns / 1e6);
+        for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++)
+        {
+            fprintf(file, ",%.4f", frame->zone_ns[zone] / 1e6);
+        }
+        fprintf(file, "\n");
+    }
+
+    fclose(file);
+    return true;
+}
@@ -0,0 +1,96 @@
+#include "profiler_overlay.h"
+#include "profiler.h"
+#include "raylib.h"
+
+#define OVERLAY_WIDTH 380
+#define OVERLAY_ROW_HEIGHT 12
+#define OVERLAY_LABEL_WIDTH 110
+#define OVERLAY_VALUE_WIDTH 60
+#define OVERLAY_GRAPH_HEIGHT 60
+#define OVERLAY_AVERAGE_FRAMES 60 // Bars show the mean over this many frames
+#define FRAME_BUDGET_MS (1000.0f / 60.0f)
+
+static Color zone_color(int zone)
+{
+    return ColorFromHSV(360.0f * zone / PROFILE_ZONE_COUNT, 0.65f, 0.95f);
+}
+
+void profiler_overlay_draw(int x, int y)
+{
+    int frame_count = profiler_frame_count();
+    int bar_x = x + OVERLAY_LABEL_WIDTH;
+    int bar_width = OVERLAY_WIDTH - OVERLAY_LABEL_WIDTH - OVERLAY_VALUE_WIDTH;
+    int rows_y = y + 40;
+    int graph_y = rows_y + PROFILE_ZONE_COUNT * OVERLAY_ROW_HEIGHT + 8;
+    int height = graph_y + OVERLAY_GRAPH_HEIGHT + 6 - y;
+
+    DrawRectangle(x, y, OVERLAY_WIDTH, height, (Color){0, 0, 0, 190});
+
+    // Average the most recent frames so the bars are readable
+    int samples = frame_count < OVERLAY_AVERAGE_FRAMES ? frame_count : OVERLAY_AVERAGE_FRAMES;
+    float zone_ms[PROFILE_ZONE_COUNT] = {0};
+    float frame_ms = 0.0f;
+    for (int i = 0; i < samples; i++)
+    {
+        const ProfileFrame *frame = profiler_frame(i);
+        frame_ms += frame->frame_ns / 1e6f;
+        for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++)
+        {
+            zone_ms[zone] += frame->zone_ns[zone] / 1e6f;
+        }
+    }
+    if (samples > 0)
+    {
+        frame_ms /= samples;
+        for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++)
+        {
+            zone_ms[zone] /= samples;
+        }
+    }
+
+    DrawText(TextFormat("frame %.2f ms  (mean of %d, budget %.1f ms)", frame_ms, samples, FRAME_BUDGET_MS),
+             x + 6, y + 4, 10, WHITE);
+
+    // Flame bar: the zones laid end to end against the frame budget
+    float scale = bar_width / FRAME_BUDGET_MS;
+    float flame_x = (float)bar_x;
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++)
+    {
+        float width = zone_ms[zone] * scale;
+        if (flame_x + width > bar_x + bar_width)
+            width = bar_x + bar_width - flame_x;
+        if (width <= 0.0f)
+            continue;
+        DrawRectangle((int)flame_x, y + 20, (int)(width + 0.5f), 12, zone_color(zone));
+        flame_x += width;
+    }
+    DrawRectangleLines(bar_x, y + 20, bar_width, 12, GRAY);
+
+    // One bar per zone
+    for (int zone = 0; zone < PROFILE_ZONE_COUNT; zone++)
+    {
+        int row_y = rows_y + zone * OVERLAY_ROW_HEIGHT;
+        int width = (int)(zone_ms[zone] * scale);
+        if (width > bar_width)
+            width = bar_width;
+
+        DrawText(profiler_zone_name((ProfileZone)zone), x + 6, row_y, 10, LIGHTGRAY);
+        DrawRectangle(bar_x, row_y + 1, width, OVERLAY_ROW_HEIGHT - 3, zone_color(zone));
+        DrawText(TextFormat("%6.3f", zone_ms[zone]), bar_x + bar_width + 6, row_y, 10, WHITE);
+    }
+
+    // Rolling frame-time graph, newest on the right, scaled so the budget line sits halfway up
+    int graph_frames = OVERLAY_WIDTH - 12;
+    int graph_x = x + 6;
+    int graph_bottom = graph_y + OVERLAY_GRAPH_HEIGHT;
+    for (int i = 0; i < graph_frames && i < frame_count; i++)
+    {
+        float ms = profiler_frame(i)->frame_ns / 1e6f;
+        int bar_height = (int)(ms / (2.0f * FRAME_BUDGET_MS) * OVERLAY_GRAPH_HEIGHT);
+        if (bar_height > OVERLAY_GRAPH_HEIGHT)
+            bar_height = OVERLAY_GRAPH_HEIGHT;
+        int column = graph_x + graph_frames - 1 - i;
+        DrawLine(column, graph_bottom, column, graph_bottom - bar_height, ms > FRAME_BUDGET_MS ? RED : GREEN);
+    }
+    DrawLine(graph_x, graph_bottom - OVERLAY_GRAPH_HEIGHT / 2, graph_x + graph_frames, graph_bottom - OVERLAY_GRAPH_HEIGHT / 2, YELLOW);
+}
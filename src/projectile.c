@@ -1,12 +1,45 @@
 #include "projectile.h"
-#include "asset_paths.h"
+#include "config.h"
+#include "collision.h"
 #include <stdlib.h>
 #include <math.h>
 
-Projectile projectile_create_fireball(Vector2 start_pos, Vector2 target_pos, ProjectileSource source)
+// Projectiles fly straight until they run out of lifetime or leave the area around the view
+static const BodyKind projectile_body_kind = {0.0f, 0.0f, INFINITY, INFINITY};
+
+static ProjectileArchetype projectile_archetypes[PROJECTILE_TYPE_COUNT] = {
+    // texture_name, texture, speed, width, height, scale, max_lifetime
+    [PROJECTILE_FIREBALL] = {"fireball.png", TEXTURE_HANDLE_INVALID, 400.0f, 16.0f, 16.0f, 0.04f, 10.0f},
+};
+
+void projectile_archetypes_load(void)
+{
+    for (int i = 0; i < PROJECTILE_TYPE_COUNT; i++)
+    {
+        projectile_archetypes[i].texture = texture_cache_acquire(projectile_archetypes[i].texture_name);
+    }
+}
+
+void projectile_archetypes_unload(void)
+{
+    for (int i = 0; i < PROJECTILE_TYPE_COUNT; i++)
+    {
+        texture_cache_release(projectile_archetypes[i].texture);
+        projectile_archetypes[i].texture = TEXTURE_HANDLE_INVALID;
+    }
+}
+
+const ProjectileArchetype *projectile_archetype(ProjectileType type)
+{
+    return &projectile_archetypes[type];
+}
+
+Projectile projectile_create(ProjectileType type, Vector2 start_pos, Vector2 target_pos, ProjectileSource source)
 {
+    const ProjectileArchetype *archetype = &projectile_archetypes[type];
     Projectile p;
     p.position = start_pos;
+    p.previous_position = start_pos;
 
     // Calculate direction to target
     float dx = target_pos.x - start_pos.x;
@@ -14,51 +47,26 @@ Projectile projectile_create_fireball(Vector2 start_pos, Vector2 target_pos, Pro
     float distance = sqrtf(dx * dx + dy * dy);
 
     // Normalize direction and apply speed
-    p.speed = 400.0f; // Fireball speed
     if (distance > 0)
     {
-        p.velocity = (Vector2){(dx / distance) * p.speed, (dy / distance) * p.speed};
+        p.velocity = (Vector2){(dx / distance) * archetype->speed, (dy / distance) * archetype->speed};
     }
     else
     {
         p.velocity = (Vector2){0, 0};
     }
 
-    p.width = 16.0f;
-    p.height = 16.0f;
-    p.texture = LoadTexture(get_asset_path("fireball.png"));
-    p.scale = 0.04f;
-    p.type = PROJECTILE_FIREBALL;
-    p.source = source;
+    p.lifetime = archetype->max_lifetime;
+    p.type = (unsigned char)type;
+    p.source = (unsigned char)source;
     p.active = true;
-    p.lifetime = 10.0f; // 10 seconds max lifetime
-    p.max_lifetime = 10.0f;
 
     return p;
 }
 
-void projectile_update(Projectile *projectile)
+Projectile projectile_create_fireball(Vector2 start_pos, Vector2 target_pos, ProjectileSource source)
 {
-    if (!projectile->active)
-        return;
-
-    // Update position based on velocity
-    projectile->position.x += projectile->velocity.x * GetFrameTime();
-    projectile->position.y += projectile->velocity.y * GetFrameTime();
-
-    // Update lifetime
-    projectile->lifetime -= GetFrameTime();
-    if (projectile->lifetime <= 0.0f)
-    {
-        projectile->active = false;
-    }
-
-    // Despawn if projectile goes too far off screen
-    float screen_x = projectile->position.x - GetScreenWidth() / 2.0f;
-    if (screen_x < -1000.0f || screen_x > GetScreenWidth() + 1000.0f)
-    {
-        projectile->active = false;
-    }
+    return projectile_create(PROJECTILE_FIREBALL, start_pos, target_pos, source);
 }
 
 void projectile_draw(Projectile *projectile, float camera_x)
@@ -66,72 +74,89 @@ void projectile_draw(Projectile *projectile, float camera_x)
     if (!projectile->active)
         return;
 
+    const ProjectileArchetype *archetype = &projectile_archetypes[projectile->type];
+
     // Apply camera offset
     Vector2 screen_pos = (Vector2){
         projectile->position.x - camera_x + GetScreenWidth() / 2.0f,
         projectile->position.y};
 
     // Offset by half the scaled texture size to center it on the position
-    float scaled_width = projectile->width * projectile->scale;
-    float scaled_height = projectile->height * projectile->scale;
+    float scaled_width = archetype->width * archetype->scale;
+    float scaled_height = archetype->height * archetype->scale;
     screen_pos.x -= scaled_width / 2.0f;
     screen_pos.y -= scaled_height / 2.0f;
 
     // Draw projectile
-    DrawTextureEx(
-        projectile->texture,
+    sprite_draw_ex(
+        texture_cache_get_sprite(archetype->texture),
         screen_pos,
         0.0f,
-        projectile->scale,
+        archetype->scale,
         WHITE);
 }
 
-bool projectile_check_player_collision(Projectile *projectile, Rectangle player_rect)
+bool projectile_check_player_collision(const Projectile *projectile, Rectangle player_from, Rectangle player_to)
 {
     if (!projectile->active || projectile->source == PROJECTILE_SOURCE_PLAYER)
         return false;
 
-    Rectangle projectile_rect = {
-        projectile->position.x,
-        projectile->position.y,
-        projectile->width,
-        projectile->height};
-
-    return CheckCollisionRecs(projectile_rect, player_rect);
+    float time_of_impact;
+    return projectile_check_swept_collision(projectile, player_from, player_to, &time_of_impact);
 }
 
-ProjectileList projectile_list_create(int capacity)
+bool projectile_check_swept_collision(const Projectile *projectile, Rectangle target_from, Rectangle target_to, float *time_of_impact)
 {
-    ProjectileList list;
-    list.projectiles = (Projectile *)malloc(sizeof(Projectile) * capacity);
-    list.count = 0;
-    list.capacity = capacity;
-    return list;
+    const ProjectileArchetype *archetype = &projectile_archetypes[projectile->type];
+    Rectangle from = {projectile->previous_position.x, projectile->previous_position.y, archetype->width, archetype->height};
+    Rectangle to = {projectile->position.x, projectile->position.y, archetype->width, archetype->height};
+    return collision_sweep(from, to, target_from, target_to, time_of_impact);
 }
 
-void projectile_list_add(ProjectileList *list, Projectile projectile)
+Rectangle projectile_swept_bounds(const Projectile *projectile)
 {
-    if (list->count < list->capacity)
-    {
-        list->projectiles[list->count++] = projectile;
-    }
+    const ProjectileArchetype *archetype = &projectile_archetypes[projectile->type];
+    Rectangle from = {projectile->previous_position.x, projectile->previous_position.y, archetype->width, archetype->height};
+    Rectangle to = {projectile->position.x, projectile->position.y, archetype->width, archetype->height};
+    return collision_sweep_bounds(from, to);
 }
 
-void projectile_list_cleanup(ProjectileList *list)
+// Textures belong to the archetypes, so projectiles need no release
+SLOT_MAP_DEFINE(ProjectileList, Projectile, projectiles, projectile_list, SLOT_MAP_NO_HOOK, SLOT_MAP_NO_HOOK)
+
+void projectile_list_update(ProjectileList *list, BodyBatch *bodies, float camera_x, float delta_time)
 {
-    if (list->projectiles)
+    // Integrate every active projectile in one batch, then copy the results back
+    body_batch_begin(bodies, list->count);
+    for (int i = 0; i < list->count; i++)
     {
-        // Unload textures for each projectile
-        for (int i = 0; i < list->count; i++)
+        Projectile *projectile = &list->projectiles[i];
+        if (projectile->active)
         {
-            if (list->projectiles[i].active)
-            {
-                UnloadTexture(list->projectiles[i].texture);
-            }
+            body_batch_add(bodies, i, projectile->position, projectile->velocity, 0.0f, projectile->lifetime, false);
         }
-        free(list->projectiles);
-        list->projectiles = NULL;
     }
-    list->count = 0;
-    list->capacity = 0;
+    body_batch_integrate(bodies, &projectile_body_kind, camera_x, delta_time);
+
+    for (int b = 0; b < bodies->count; b++)
+    {
+        Projectile *projectile = &list->projectiles[bodies->source[b]];
+        projectile->previous_position = projectile->position;
+        projectile->position = (Vector2){bodies->x[b], bodies->y[b]};
+        projectile->lifetime = bodies->lifetime[b];
+    }
+    for (int e = 0; e < bodies->expired_count; e++)
+    {
+        list->projectiles[bodies->expired[e]].active = false;
+    }
+
+    // Drop spent projectiles (expired now or destroyed on impact last step) so their slots
+    // are reused
+    for (int i = 0; i < list->count;)
+    {
+        if (list->projectiles[i].active)
+            i++;
+        else
+            projectile_list_remove_at(list, i);
+    }
 }
@@ -0,0 +1,289 @@
+#include "replay.h"
+#include "config.h"
+#include <string.h>
+
+#define REPLAY_MAGIC "KTVR"
+
+// Input flag bits
+#define INPUT_MOVE_LEFT (1 << 0)
+#define INPUT_MOVE_RIGHT (1 << 1)
+#define INPUT_DUCK (1 << 2)
+#define INPUT_SWORD (1 << 3)
+#define INPUT_JUMP (1 << 4)
+#define INPUT_HEALTH_POTION (1 << 5)
+#define INPUT_PROTECTION_POTION (1 << 6)
+#define INPUT_FIRE (1 << 7)
+
+// Control flag bits
+#define CONTROL_PAUSE_MENU (1 << 0)
+
+// ============ ENCODING HELPERS ============
+
+static void write_u16(FILE *file, unsigned int value)
+{
+    fputc(value & 0xFF, file);
+    fputc((value >> 8) & 0xFF, file);
+}
+
+static void write_u32(FILE *file, unsigned int value)
+{
+    write_u16(file, value & 0xFFFF);
+    write_u16(file, (value >> 16) & 0xFFFF);
+}
+
+static void write_f32(FILE *file, float value)
+{
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(bits));
+    write_u32(file, bits);
+}
+
+// LEB128: 7 bits per byte, high bit set on all but the last byte
+static void write_varint(FILE *file, unsigned int value)
+{
+    while (value >= 0x80)
+    {
+        fputc((value & 0x7F) | 0x80, file);
+        value >>= 7;
+    }
+    fputc(value, file);
+}
+
+static bool read_u16(FILE *file, unsigned int *value)
+{
+    int lo = fgetc(file);
+    int hi = fgetc(file);
+    if (lo == EOF || hi == EOF)
+        return false;
+    *value = (unsigned int)lo | ((unsigned int)hi << 8);
+    return true;
+}
+
+static bool read_u32(FILE *file, unsigned int *value)
+{
+    unsigned int lo, hi;
+    if (!read_u16(file, &lo) || !read_u16(file, &hi))
+        return false;
+    *value = lo | (hi << 16);
+    return true;
+}
+
+static bool read_f32(FILE *file, float *value)
+{
+    unsigned int bits;
+    if (!read_u32(file, &bits))
+        return false;
+    memcpy(value, &bits, sizeof(bits));
+    return true;
+}
+
+static bool read_varint(FILE *file, unsigned int *value)
+{
+    unsigned int result = 0;
+    for (int shift = 0; shift < 32; shift += 7)
+    {
+        int byte = fgetc(file);
+        if (byte == EOF)
+            return false;
+        result |= (unsigned int)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+static unsigned int pack_input(const PlayerInput *input)
+{
+    unsigned int flags = 0;
+    if (input->move_left)
+        flags |= INPUT_MOVE_LEFT;
+    if (input->move_right)
+        flags |= INPUT_MOVE_RIGHT;
+    if (input->duck)
+        flags |= INPUT_DUCK;
+    if (input->sword)
+        flags |= INPUT_SWORD;
+    if (input->jump)
+        flags |= INPUT_JUMP;
+    if (input->use_health_potion)
+        flags |= INPUT_HEALTH_POTION;
+    if (input->use_protection_potion)
+        flags |= INPUT_PROTECTION_POTION;
+    if (input->fire)
+        flags |= INPUT_FIRE;
+    return flags;
+}
+
+static PlayerInput unpack_input(unsigned int flags)
+{
+    PlayerInput input = {0};
+    input.move_left = (flags & INPUT_MOVE_LEFT) != 0;
+    input.move_right = (flags & INPUT_MOVE_RIGHT) != 0;
+    input.duck = (flags & INPUT_DUCK) != 0;
+    input.sword = (flags & INPUT_SWORD) != 0;
+    input.jump = (flags & INPUT_JUMP) != 0;
+    input.use_health_potion = (flags & INPUT_HEALTH_POTION) != 0;
+    input.use_protection_potion = (flags & INPUT_PROTECTION_POTION) != 0;
+    input.fire = (flags & INPUT_FIRE) != 0;
+    return input;
+}
+
+static bool ticks_equal(const ReplayTick *a, const ReplayTick *b)
+{
+    if (pack_input(&a->input) != pack_input(&b->input) || a->pause_menu_active != b->pause_menu_active)
+        return false;
+
+    // The aim point only matters on ticks that fire
+    return !a->input.fire || (a->input.fire_target.x == b->input.fire_target.x &&
+                              a->input.fire_target.y == b->input.fire_target.y);
+}
+
+static void write_run(ReplayRecorder *recorder)
+{
+    const ReplayTick *tick = &recorder->run_tick;
+    fputc(pack_input(&tick->input), recorder->file);
+    fputc(tick->pause_menu_active ? CONTROL_PAUSE_MENU : 0, recorder->file);
+    if (tick->input.fire)
+    {
+        write_f32(recorder->file, tick->input.fire_target.x);
+        write_f32(recorder->file, tick->input.fire_target.y);
+    }
+    write_varint(recorder->file, recorder->run_length);
+}
+
+// ============ RECORDING ============
+
+bool replay_recorder_open(ReplayRecorder *recorder, const char *path, unsigned int seed, int start_level)
+{
+    memset(recorder, 0, sizeof(ReplayRecorder));
+    recorder->file = fopen(path, "wb");
+    if (!recorder->file)
+    {
+        TraceLog(LOG_WARNING, "REPLAY: Could not open '%s' for writing", path);
+        return false;
+    }
+
+    fwrite(REPLAY_MAGIC, 1, 4, recorder->file);
+    write_u16(recorder->file, REPLAY_VERSION);
+    write_u32(recorder->file, seed);
+    write_u16(recorder->file, (unsigned int)start_level);
+    write_u16(recorder->file, SIMULATION_TICK_RATE);
+    return true;
+}
+
+void replay_recorder_write(ReplayRecorder *recorder, const ReplayTick *tick)
+{
+    if (!recorder->file)
+        return;
+
+    recorder->tick_count++;
+    if (recorder->run_length > 0 && ticks_equal(&recorder->run_tick, tick))
+    {
+        recorder->run_length++;
+        return;
+    }
+
+    if (recorder->run_length > 0)
+    {
+        write_run(recorder);
+    }
+    recorder->run_tick = *tick;
+    recorder->run_length = 1;
+}
+
+void replay_recorder_close(ReplayRecorder *recorder)
+{
+    if (!recorder->file)
+        return;
+
+    if (recorder->run_length > 0)
+    {
+        write_run(recorder);
+    }
+    fclose(recorder->file);
+    recorder->file = NULL;
+    recorder->run_length = 0;
+}
+
+// ============ PLAYBACK ============
+
+bool replay_player_open(ReplayPlayer *player, const char *path)
+{
+    memset(player, 0, sizeof(ReplayPlayer));
+    player->file = fopen(path, "rb");
+    if (!player->file)
+    {
+        TraceLog(LOG_WARNING, "REPLAY: Could not open '%s'", path);
+        return false;
+    }
+
+    char magic[4];
+    unsigned int version, seed, start_level, tick_rate;
+    bool valid = fread(magic, 1, 4, player->file) == 4 && memcmp(magic, REPLAY_MAGIC, 4) == 0 &&
+                 read_u16(player->file, &version) && version == REPLAY_VERSION &&
+                 read_u32(player->file, &seed) &&
+                 read_u16(player->file, &start_level) &&
+                 read_u16(player->file, &tick_rate);
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "REPLAY: '%s' is not a version %d replay", path, REPLAY_VERSION);
+        replay_player_close(player);
+        return false;
+    }
+
+    // A different tick rate would step the physics differently, so the run would diverge
+    if (tick_rate != SIMULATION_TICK_RATE)
+    {
+        TraceLog(LOG_WARNING, "REPLAY: '%s' was recorded at %u ticks/s, expected %d", path, tick_rate, SIMULATION_TICK_RATE);
+    }
+
+    player->seed = seed;
+    player->start_level = (int)start_level;
+    player->tick_rate = (int)tick_rate;
+    return true;
+}
+
+bool replay_player_next(ReplayPlayer *player, ReplayTick *tick)
+{
+    if (!player->file)
+        return false;
+
+    if (player->run_remaining == 0)
+    {
+        int flags = fgetc(player->file);
+        int control = fgetc(player->file);
+        if (flags == EOF || control == EOF)
+            return false;
+
+        ReplayTick run = {0};
+        run.input = unpack_input((unsigned int)flags);
+        run.pause_menu_active = (control & CONTROL_PAUSE_MENU) != 0;
+        if (run.input.fire &&
+            (!read_f32(player->file, &run.input.fire_target.x) || !read_f32(player->file, &run.input.fire_target.y)))
+            return false;
+
+        unsigned int length;
+        if (!read_varint(player->file, &length) || length == 0)
+            return false;
+
+        player->run_tick = run;
+        player->run_remaining = length;
+    }
+
+    *tick = player->run_tick;
+    player->run_remaining--;
+    player->tick_count++;
+    return true;
+}
+
+void replay_player_close(ReplayPlayer *player)
+{
+    if (player->file)
+    {
+        fclose(player->file);
+        player->file = NULL;
+    }
+}
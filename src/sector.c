@@ -0,0 +1,39 @@
+#include "sector.h"
+#include <math.h>
+
+int sector_of(float x)
+{
+    return (int)floorf(x / SIM_SECTOR_WIDTH);
+}
+
+SectorWindow sector_window(float camera_x, int radius)
+{
+    int center = sector_of(camera_x);
+    SectorWindow window;
+    window.first = center - radius;
+    window.last = center + radius;
+    window.min_x = (float)window.first * SIM_SECTOR_WIDTH;
+    window.max_x = (float)(window.last + 1) * SIM_SECTOR_WIDTH;
+    return window;
+}
+
+int sector_window_count(const SectorWindow *window)
+{
+    return window->last - window->first + 1;
+}
+
+bool sector_window_contains(const SectorWindow *window, float x)
+{
+    return x >= window->min_x && x < window->max_x;
+}
+
+bool sector_window_overlaps(const SectorWindow *window, float min_x, float max_x)
+{
+    return max_x >= window->min_x && min_x < window->max_x;
+}
+
+int sector_stats_skipped(const SectorStats *stats)
+{
+    return stats->hazards_skipped + stats->monsters_skipped + stats->pickups_skipped +
+           stats->loot_skipped + stats->spawners_skipped;
+}
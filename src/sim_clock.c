@@ -0,0 +1,30 @@
+#include "sim_clock.h"
+
+#if defined(_WIN32)
+// Declared by hand: windows.h clashes with raylib names (Rectangle, CloseWindow, ...)
+__declspec(dllimport) int __stdcall QueryPerformanceCounter(long long *count);
+__declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long *frequency);
+
+unsigned long long sim_clock_ns(void)
+{
+    static long long frequency = 0;
+    long long count;
+    if (frequency == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&count);
+
+    // Split to avoid overflowing count * 1e9
+    unsigned long long seconds = (unsigned long long)(count / frequency);
+    unsigned long long remainder = (unsigned long long)(count % frequency);
+    return seconds * 1000000000ULL + remainder * 1000000000ULL / (unsigned long long)frequency;
+}
+#else
+#include <time.h>
+
+unsigned long long sim_clock_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+#endif
@@ -0,0 +1,79 @@
+#include "slot_map.h"
+
+void slot_table_reserve(SlotTable *table, int capacity)
+{
+    if (capacity <= table->capacity)
+        return;
+
+    table->item_index = (int *)realloc(table->item_index, sizeof(int) * capacity);
+    table->generation = (unsigned int *)realloc(table->generation, sizeof(unsigned int) * capacity);
+    table->slot_of = (int *)realloc(table->slot_of, sizeof(int) * capacity);
+    table->free_slots = (int *)realloc(table->free_slots, sizeof(int) * capacity);
+    table->capacity = capacity;
+}
+
+SlotHandle slot_table_insert(SlotTable *table, int index)
+{
+    // Reuse the most recently freed slot; a new slot is only needed past the previous peak
+    int slot;
+    if (table->free_count > 0)
+    {
+        slot = table->free_slots[--table->free_count];
+    }
+    else
+    {
+        slot = table->slot_count++;
+        table->generation[slot] = 0;
+    }
+
+    table->item_index[slot] = index;
+    table->slot_of[index] = slot;
+    return (SlotHandle){slot, table->generation[slot]};
+}
+
+void slot_table_remove(SlotTable *table, int index, int last)
+{
+    int slot = table->slot_of[index];
+    table->generation[slot]++; // Outstanding handles to this slot are now stale
+    table->free_slots[table->free_count++] = slot;
+
+    // The last item moves into the hole
+    if (index != last)
+    {
+        int moved = table->slot_of[last];
+        table->item_index[moved] = index;
+        table->slot_of[index] = moved;
+    }
+}
+
+int slot_table_find(const SlotTable *table, SlotHandle handle)
+{
+    if (handle.slot < 0 || handle.slot >= table->slot_count || table->generation[handle.slot] != handle.generation)
+        return -1;
+    return table->item_index[handle.slot];
+}
+
+SlotHandle slot_table_handle(const SlotTable *table, int index)
+{
+    int slot = table->slot_of[index];
+    return (SlotHandle){slot, table->generation[slot]};
+}
+
+void slot_table_clear(SlotTable *table, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        int slot = table->slot_of[i];
+        table->generation[slot]++;
+        table->free_slots[table->free_count++] = slot;
+    }
+}
+
+void slot_table_cleanup(SlotTable *table)
+{
+    free(table->item_index);
+    free(table->generation);
+    free(table->slot_of);
+    free(table->free_slots);
+    *table = (SlotTable){0};
+}
@@ -0,0 +1,191 @@
+#include "texture_atlas.h"
+#include "asset_paths.h"
+#include "trace.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEXTURE_ATLAS_NAME_LENGTH 64
+
+typedef struct
+{
+    char name[TEXTURE_ATLAS_NAME_LENGTH]; // Asset filename
+    int page;                             // Atlas page index
+    Rectangle source;                     // Location of the sprite in its page
+} AtlasSprite;
+
+static Texture2D pages[TEXTURE_ATLAS_MAX_PAGES];
+static int page_count = 0;
+static AtlasSprite sprites[TEXTURE_ATLAS_MAX_SPRITES];
+static int sprite_count = 0;
+
+// Image waiting to be packed
+typedef struct
+{
+    const char *name;
+    Image image;
+    int page;
+    Rectangle source;
+} PackItem;
+
+// Tallest first gives the shelf packer tight rows
+static int compare_pack_items(const void *a, const void *b)
+{
+    const PackItem *item_a = (const PackItem *)a;
+    const PackItem *item_b = (const PackItem *)b;
+    if (item_a->image.height != item_b->image.height)
+        return item_b->image.height - item_a->image.height;
+    return strcmp(item_a->name, item_b->name); // Stable order so the layout is deterministic
+}
+
+int texture_atlas_build(void)
+{
+    texture_atlas_unload();
+
+    FilePathList files = LoadDirectoryFilesEx(get_asset_directory(), ".png", false);
+    if (files.count == 0)
+    {
+        UnloadDirectoryFiles(files);
+        return 0;
+    }
+
+    PackItem *items = (PackItem *)calloc(files.count, sizeof(PackItem));
+    int item_count = 0;
+
+    for (unsigned int i = 0; i < files.count && item_count < TEXTURE_ATLAS_MAX_SPRITES; i++)
+    {
+        TRACE_BEGIN_DETAIL("LoadImage", GetFileName(files.paths[i]));
+        Image image = LoadImage(files.paths[i]);
+        TRACE_END("LoadImage");
+        if (image.data == NULL)
+            continue;
+
+        // Sprites bigger than a page keep using their own texture
+        if (image.width + TEXTURE_ATLAS_PADDING > TEXTURE_ATLAS_PAGE_SIZE ||
+            image.height + TEXTURE_ATLAS_PADDING > TEXTURE_ATLAS_PAGE_SIZE)
+        {
+            UnloadImage(image);
+            continue;
+        }
+
+        items[item_count].name = GetFileName(files.paths[i]);
+        items[item_count].image = image;
+        items[item_count].page = -1;
+        item_count++;
+    }
+
+    qsort(items, item_count, sizeof(PackItem), compare_pack_items);
+
+    // Shelf packing: fill rows left to right, start a new row (or page) when full
+    int page_heights[TEXTURE_ATLAS_MAX_PAGES] = {0};
+    int page = 0;
+    int cursor_x = 0;
+    int shelf_y = 0;
+    int shelf_height = 0;
+
+    for (int i = 0; i < item_count; i++)
+    {
+        int width = items[i].image.width + TEXTURE_ATLAS_PADDING;
+        int height = items[i].image.height + TEXTURE_ATLAS_PADDING;
+
+        if (cursor_x + width > TEXTURE_ATLAS_PAGE_SIZE)
+        {
+            // Start a new shelf
+            shelf_y += shelf_height;
+            cursor_x = 0;
+            shelf_height = 0;
+        }
+
+        if (shelf_y + height > TEXTURE_ATLAS_PAGE_SIZE)
+        {
+            // Start a new page
+            page++;
+            cursor_x = 0;
+            shelf_y = 0;
+            shelf_height = 0;
+        }
+
+        if (page >= TEXTURE_ATLAS_MAX_PAGES)
+            break; // Remaining sprites fall back to standalone textures
+
+        items[i].page = page;
+        items[i].source = (Rectangle){(float)cursor_x, (float)shelf_y,
+                                      (float)items[i].image.width, (float)items[i].image.height};
+
+        cursor_x += width;
+        if (height > shelf_height)
+            shelf_height = height;
+        if (shelf_y + shelf_height > page_heights[page])
+            page_heights[page] = shelf_y + shelf_height;
+    }
+
+    // Compose each page on the CPU and upload it once.
+    // Pages are cropped to the rows actually used to avoid wasting VRAM.
+    for (int p = 0; p < TEXTURE_ATLAS_MAX_PAGES && page_heights[p] > 0; p++)
+    {
+        Image page_image = GenImageColor(TEXTURE_ATLAS_PAGE_SIZE, page_heights[p], BLANK);
+
+        for (int i = 0; i < item_count; i++)
+        {
+            if (items[i].page != p)
+                continue;
+
+            Rectangle image_rect = {0, 0, (float)items[i].image.width, (float)items[i].image.height};
+            ImageDraw(&page_image, items[i].image, image_rect, items[i].source, WHITE);
+
+            AtlasSprite *sprite = &sprites[sprite_count++];
+            strncpy(sprite->name, items[i].name, TEXTURE_ATLAS_NAME_LENGTH - 1);
+            sprite->name[TEXTURE_ATLAS_NAME_LENGTH - 1] = '\0';
+            sprite->page = p;
+            sprite->source = items[i].source;
+        }
+
+        TRACE_BEGIN("LoadTextureFromImage");
+        pages[p] = LoadTextureFromImage(page_image);
+        TRACE_END("LoadTextureFromImage");
+        UnloadImage(page_image);
+        page_count++;
+    }
+
+    for (int i = 0; i < item_count; i++)
+    {
+        UnloadImage(items[i].image);
+    }
+    free(items);
+    UnloadDirectoryFiles(files);
+
+    TraceLog(LOG_INFO, "TEXTURE ATLAS: Packed %d sprites into %d page(s)", sprite_count, page_count);
+    return sprite_count;
+}
+
+bool texture_atlas_find(const char *asset_name, Texture2D *page, Rectangle *source)
+{
+    for (int i = 0; i < sprite_count; i++)
+    {
+        if (strcmp(sprites[i].name, asset_name) == 0 && pages[sprites[i].page].id > 0)
+        {
+            *page = pages[sprites[i].page];
+            *source = sprites[i].source;
+            return true;
+        }
+    }
+    return false;
+}
+
+int texture_atlas_page_count(void)
+{
+    return page_count;
+}
+
+void texture_atlas_unload(void)
+{
+    for (int i = 0; i < page_count; i++)
+    {
+        if (pages[i].id > 0)
+        {
+            UnloadTexture(pages[i]);
+        }
+        pages[i] = (Texture2D){0};
+    }
+    page_count = 0;
+    sprite_count = 0;
+}
@@ -0,0 +1,214 @@
+#include "texture_cache.h"
+#include "texture_atlas.h"
+#include "asset_paths.h"
+#include "trace.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEXTURE_CACHE_NAME_LENGTH 64
+#define TEXTURE_HANDLE_SLOT_BITS 8 // Room for TEXTURE_CACHE_MAX_ENTRIES slots (plus the 0 handle)
+#define TEXTURE_HANDLE_SLOT_MASK ((1 << TEXTURE_HANDLE_SLOT_BITS) - 1)
+#define TEXTURE_HANDLE_GENERATION_MASK 0x7FFFFF // Keeps handles positive
+
+typedef struct
+{
+    char name[TEXTURE_CACHE_NAME_LENGTH]; // Normalized asset filename (empty when slot is free)
+    Texture2D texture;                    // GPU texture (id may be 0 if the load failed)
+    Rectangle source;                     // Region of the texture holding this asset
+    bool in_atlas;                        // Texture is an atlas page owned by texture_atlas.c
+    int ref_count;                        // Number of owners holding this handle
+} TextureCacheEntry;
+
+static TextureCacheEntry entries[TEXTURE_CACHE_MAX_ENTRIES];
+static int generations[TEXTURE_CACHE_MAX_ENTRIES]; // Per slot: bumped every time its entry is freed
+static bool headless = false;
+
+// Level files pass paths like "../assets/bat.png" while others pass "bat.png".
+// Everything lives in assets/, so key the registry by the bare filename.
+static const char *normalize_asset_name(const char *asset_name)
+{
+    const char *last_slash = strrchr(asset_name, '/');
+    const char *last_backslash = strrchr(asset_name, '\\');
+    if (last_backslash && (!last_slash || last_backslash > last_slash))
+        last_slash = last_backslash;
+    return last_slash ? last_slash + 1 : asset_name;
+}
+
+// Read an image's size without decoding it. PNG stores width and height big-endian in the
+// IHDR chunk at bytes 16-23; anything else falls back to a CPU-side LoadImage.
+static Rectangle read_image_bounds(const char *path)
+{
+    unsigned char header[24];
+    FILE *file = fopen(path, "rb");
+    if (file)
+    {
+        size_t read = fread(header, 1, sizeof(header), file);
+        fclose(file);
+        if (read == sizeof(header) && memcmp(header + 1, "PNG", 3) == 0)
+        {
+            int width = (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+            int height = (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+            return (Rectangle){0, 0, (float)width, (float)height};
+        }
+    }
+
+    Image image = LoadImage(path);
+    Rectangle bounds = {0, 0, (float)image.width, (float)image.height};
+    UnloadImage(image);
+    return bounds;
+}
+
+static TextureHandle handle_for_slot(int slot)
+{
+    return (generations[slot] << TEXTURE_HANDLE_SLOT_BITS) | (slot + 1);
+}
+
+static TextureCacheEntry *entry_for_handle(TextureHandle handle)
+{
+    int slot = (handle & TEXTURE_HANDLE_SLOT_MASK) - 1;
+    if (handle <= TEXTURE_HANDLE_INVALID || slot < 0 || slot >= TEXTURE_CACHE_MAX_ENTRIES)
+        return NULL;
+
+    TextureCacheEntry *entry = &entries[slot];
+    if (entry->ref_count <= 0 || handle != handle_for_slot(slot))
+        return NULL;
+
+    return entry;
+}
+
+// Free a slot; handles to it go stale
+static void entry_free(int slot)
+{
+    memset(&entries[slot], 0, sizeof(TextureCacheEntry));
+    generations[slot] = (generations[slot] + 1) & TEXTURE_HANDLE_GENERATION_MASK;
+}
+
+TextureHandle texture_cache_acquire(const char *asset_name)
+{
+    if (asset_name == NULL || asset_name[0] == '\0')
+        return TEXTURE_HANDLE_INVALID;
+
+    const char *name = normalize_asset_name(asset_name);
+    int free_slot = -1;
+
+    // Reuse the entry if this asset is already resident
+    for (int i = 0; i < TEXTURE_CACHE_MAX_ENTRIES; i++)
+    {
+        if (entries[i].ref_count > 0)
+        {
+            if (strcmp(entries[i].name, name) == 0)
+            {
+                entries[i].ref_count++;
+                return handle_for_slot(i);
+            }
+        }
+        else if (free_slot == -1)
+        {
+            free_slot = i;
+        }
+    }
+
+    if (free_slot == -1)
+    {
+        TraceLog(LOG_WARNING, "TEXTURE CACHE: Registry full, cannot load '%s'", name);
+        return TEXTURE_HANDLE_INVALID;
+    }
+
+    // First use of this asset - point at the atlas if it was packed, otherwise load it from disk once
+    TextureCacheEntry *entry = &entries[free_slot];
+    strncpy(entry->name, name, TEXTURE_CACHE_NAME_LENGTH - 1);
+    entry->name[TEXTURE_CACHE_NAME_LENGTH - 1] = '\0';
+    entry->in_atlas = !headless && texture_atlas_find(name, &entry->texture, &entry->source);
+    if (headless)
+    {
+        // No GPU: keep only the size so entity dimensions match the windowed game
+        entry->texture = (Texture2D){0};
+        entry->source = read_image_bounds(get_asset_path(name));
+    }
+    else if (!entry->in_atlas)
+    {
+        TRACE_BEGIN_DETAIL("LoadTexture", name);
+        entry->texture = LoadTexture(get_asset_path(name));
+        TRACE_END("LoadTexture");
+        entry->source = (Rectangle){0, 0, (float)entry->texture.width, (float)entry->texture.height};
+    }
+    entry->ref_count = 1;
+
+    return handle_for_slot(free_slot);
+}
+
+void texture_cache_set_headless(bool enabled)
+{
+    headless = enabled;
+}
+
+void texture_cache_release(TextureHandle handle)
+{
+    TextureCacheEntry *entry = entry_for_handle(handle);
+    if (!entry)
+        return;
+
+    entry->ref_count--;
+    if (entry->ref_count == 0)
+    {
+        if (!entry->in_atlas && entry->texture.id > 0)
+        {
+            UnloadTexture(entry->texture);
+        }
+        entry_free((int)(entry - entries));
+    }
+}
+
+Sprite texture_cache_get_sprite(TextureHandle handle)
+{
+    TextureCacheEntry *entry = entry_for_handle(handle);
+    if (!entry)
+        return (Sprite){0};
+
+    return (Sprite){entry->texture, entry->source};
+}
+
+void sprite_draw_ex(Sprite sprite, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle dest = {position.x, position.y, sprite.source.width * scale, sprite.source.height * scale};
+    DrawTexturePro(sprite.texture, sprite.source, dest, (Vector2){0, 0}, rotation, tint);
+}
+
+void sprite_draw_pro(Sprite sprite, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    DrawTexturePro(sprite.texture, sprite.source, dest, origin, rotation, tint);
+}
+
+int texture_cache_loaded_count(void)
+{
+    int count = 0;
+    for (int i = 0; i < TEXTURE_CACHE_MAX_ENTRIES; i++)
+    {
+        if (entries[i].ref_count > 0)
+            count++;
+    }
+    return count;
+}
+
+int texture_cache_ref_count(TextureHandle handle)
+{
+    TextureCacheEntry *entry = entry_for_handle(handle);
+    return entry ? entry->ref_count : 0;
+}
+
+void texture_cache_shutdown(void)
+{
+    for (int i = 0; i < TEXTURE_CACHE_MAX_ENTRIES; i++)
+    {
+        if (entries[i].ref_count > 0)
+        {
+            if (!entries[i].in_atlas && entries[i].texture.id > 0)
+            {
+                UnloadTexture(entries[i].texture);
+            }
+            entry_free(i);
+        }
+    }
+
+    texture_atlas_unload();
+}
@@ -0,0 +1,46 @@
+#include "think_schedule.h"
+#include <math.h>
+
+ThinkBand think_band(float distance)
+{
+    if (distance < AI_NEAR_DISTANCE)
+        return THINK_BAND_NEAR;
+    if (distance < AI_MID_DISTANCE)
+        return THINK_BAND_MID;
+    return THINK_BAND_DORMANT;
+}
+
+int think_schedule(const float *x, int count, float camera_x, unsigned int tick, float delta_time,
+                   float *owed, float *think_dt)
+{
+    int thinking = 0;
+    for (int i = 0; i < count; i++)
+    {
+        switch (think_band(fabsf(x[i] - camera_x)))
+        {
+        case THINK_BAND_NEAR:
+            think_dt[i] = owed[i] + delta_time;
+            owed[i] = 0.0f;
+            thinking++;
+            break;
+        case THINK_BAND_MID:
+            if ((tick + (unsigned int)i) % THINK_MID_INTERVAL == 0)
+            {
+                think_dt[i] = owed[i] + delta_time;
+                owed[i] = 0.0f;
+                thinking++;
+            }
+            else
+            {
+                think_dt[i] = 0.0f;
+                owed[i] += delta_time;
+            }
+            break;
+        case THINK_BAND_DORMANT:
+            think_dt[i] = 0.0f;
+            owed[i] = 0.0f;
+            break;
+        }
+    }
+    return thinking;
+}
@@ -0,0 +1,204 @@
+#include "timer_wheel.h"
+#include "config.h"
+#include <stdlib.h>
+#include <math.h>
+
+#define SLOT_MASK (TIMER_WHEEL_SLOTS - 1)
+#define MAX_TICKS ((1u << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS)) - 1u)
+
+TimerWheel timer_wheel_create(int capacity)
+{
+    TimerWheel wheel = {0};
+    wheel.capacity = capacity > 0 ? capacity : 16;
+    wheel.nodes = (TimerNode *)malloc(sizeof(TimerNode) * wheel.capacity);
+    wheel.free_head = -1;
+    for (int b = 0; b < TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS; b++)
+    {
+        wheel.heads[b] = -1;
+        wheel.tails[b] = -1;
+    }
+    return wheel;
+}
+
+void timer_wheel_cleanup(TimerWheel *wheel)
+{
+    free(wheel->nodes);
+    *wheel = (TimerWheel){0};
+}
+
+unsigned int timer_ticks(float seconds)
+{
+    // The small bias keeps whole-tick durations (e.g. 3 s = 360 ticks) from rounding up
+    float ticks = ceilf(seconds * SIMULATION_TICK_RATE - 1e-3f);
+    return ticks < 1.0f ? 1u : (unsigned int)ticks;
+}
+
+// The slot list a timer due at expires belongs in, seen from wheel->now
+static int bucket_for(const TimerWheel *wheel, unsigned int expires)
+{
+    unsigned int delta = expires - wheel->now;
+    int level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 && delta >= (1u << (TIMER_WHEEL_SLOT_BITS * (level + 1))))
+    {
+        level++;
+    }
+    return level * TIMER_WHEEL_SLOTS + (int)((expires >> (TIMER_WHEEL_SLOT_BITS * level)) & SLOT_MASK);
+}
+
+static void link_tail(TimerWheel *wheel, int node, int bucket)
+{
+    TimerNode *timer = &wheel->nodes[node];
+    timer->bucket = bucket;
+    timer->prev = wheel->tails[bucket];
+    timer->next = -1;
+    if (timer->prev >= 0)
+        wheel->nodes[timer->prev].next = node;
+    else
+        wheel->heads[bucket] = node;
+    wheel->tails[bucket] = node;
+}
+
+static void unlink_node(TimerWheel *wheel, int node)
+{
+    TimerNode *timer = &wheel->nodes[node];
+    if (timer->prev >= 0)
+        wheel->nodes[timer->prev].next = timer->next;
+    else
+        wheel->heads[timer->bucket] = timer->next;
+    if (timer->next >= 0)
+        wheel->nodes[timer->next].prev = timer->prev;
+    else
+        wheel->tails[timer->bucket] = timer->prev;
+}
+
+// Retire a node that is no longer in any list; handles to it stop matching
+static void free_node(TimerWheel *wheel, int node)
+{
+    TimerNode *timer = &wheel->nodes[node];
+    timer->generation++;
+    timer->bucket = -1;
+    timer->next = wheel->free_head;
+    wheel->free_head = node;
+    wheel->pending--;
+}
+
+void timer_wheel_clear(TimerWheel *wheel)
+{
+    for (int node = 0; node < wheel->node_count; node++)
+    {
+        if (wheel->nodes[node].bucket >= 0)
+            free_node(wheel, node);
+    }
+    for (int b = 0; b < TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS; b++)
+    {
+        wheel->heads[b] = -1;
+        wheel->tails[b] = -1;
+    }
+}
+
+TimerHandle timer_wheel_schedule(TimerWheel *wheel, unsigned int ticks, TimerCallback callback, void *context, int arg)
+{
+    int node = wheel->free_head;
+    if (node >= 0)
+    {
+        wheel->free_head = wheel->nodes[node].next;
+    }
+    else
+    {
+        if (wheel->node_count >= wheel->capacity)
+        {
+            wheel->capacity *= 2;
+            wheel->nodes = (TimerNode *)realloc(wheel->nodes, sizeof(TimerNode) * wheel->capacity);
+        }
+        node = wheel->node_count++;
+        wheel->nodes[node].generation = 0;
+    }
+
+    ticks = ticks < 1u ? 1u : (ticks > MAX_TICKS ? MAX_TICKS : ticks);
+
+    TimerNode *timer = &wheel->nodes[node];
+    timer->expires = wheel->now + ticks;
+    timer->callback = callback;
+    timer->context = context;
+    timer->arg = arg;
+    link_tail(wheel, node, bucket_for(wheel, timer->expires));
+    wheel->pending++;
+
+    return (TimerHandle){node, timer->generation};
+}
+
+void timer_wheel_restart(TimerWheel *wheel, TimerHandle *handle, unsigned int ticks, TimerCallback callback, void *context, int arg)
+{
+    timer_wheel_cancel(wheel, *handle);
+    *handle = timer_wheel_schedule(wheel, ticks, callback, context, arg);
+}
+
+bool timer_wheel_pending(const TimerWheel *wheel, TimerHandle handle)
+{
+    return handle.node >= 0 && handle.node < wheel->node_count &&
+           wheel->nodes[handle.node].generation == handle.generation && wheel->nodes[handle.node].bucket >= 0;
+}
+
+bool timer_wheel_cancel(TimerWheel *wheel, TimerHandle handle)
+{
+    if (!timer_wheel_pending(wheel, handle))
+        return false;
+
+    unlink_node(wheel, handle.node);
+    free_node(wheel, handle.node);
+    return true;
+}
+
+float timer_wheel_remaining(const TimerWheel *wheel, TimerHandle handle)
+{
+    if (!timer_wheel_pending(wheel, handle))
+        return 0.0f;
+    return (float)(wheel->nodes[handle.node].expires - wheel->now) / SIMULATION_TICK_RATE;
+}
+
+// Spread a coarse slot over the levels below it, keeping the timers' order
+static void cascade(TimerWheel *wheel, int bucket)
+{
+    int node = wheel->heads[bucket];
+    wheel->heads[bucket] = -1;
+    wheel->tails[bucket] = -1;
+    while (node >= 0)
+    {
+        int next = wheel->nodes[node].next;
+        link_tail(wheel, node, bucket_for(wheel, wheel->nodes[node].expires));
+        node = next;
+    }
+}
+
+int timer_wheel_advance(TimerWheel *wheel)
+{
+    unsigned int now = ++wheel->now;
+
+    // Each time a level wraps, the next slot of the level above comes due
+    for (int level = 1; level < TIMER_WHEEL_LEVELS; level++)
+    {
+        if ((now & ((1u << (TIMER_WHEEL_SLOT_BITS * level)) - 1u)) != 0)
+            break;
+        cascade(wheel, level * TIMER_WHEEL_SLOTS + (int)((now >> (TIMER_WHEEL_SLOT_BITS * level)) & SLOT_MASK));
+    }
+
+    // Everything left in this tick's level 0 slot is due now. Timers scheduled by the
+    // callbacks land at least one tick ahead, in other slots.
+    int bucket = (int)(now & SLOT_MASK);
+    int fired = 0;
+    while (wheel->heads[bucket] >= 0)
+    {
+        int node = wheel->heads[bucket];
+        TimerNode *timer = &wheel->nodes[node];
+        TimerCallback callback = timer->callback;
+        void *context = timer->context;
+        int arg = timer->arg;
+
+        unlink_node(wheel, node);
+        free_node(wheel, node);
+        fired++;
+        if (callback)
+            callback(context, arg);
+    }
+    return fired;
+}
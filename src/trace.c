@@ -0,0 +1,209 @@
+#include "trace.h"
+#include "sim_clock.h"
+#include <stdio.h>
+#include <string.h>
+
+// Windows builds have no pthreads; there full chunks are written on the game thread instead
+#if !defined(_WIN32)
+#define TRACE_WRITER_THREAD
+#include <pthread.h>
+#endif
+
+#define TRACE_CHUNK_EVENTS 4096 // Events per buffer handed to the writer
+
+typedef struct
+{
+    const char *name;
+    char detail[TRACE_DETAIL_LENGTH];
+    unsigned long long timestamp_ns;
+    char phase; // 'B' (begin) or 'E' (end)
+} TraceEvent;
+
+// Two chunks: the game thread fills one while the writer drains the other
+static TraceEvent chunks[2][TRACE_CHUNK_EVENTS];
+static int fill_chunk = 0;
+static int fill_count = 0;
+
+static FILE *trace_file = NULL;
+static bool active = false;
+static bool wrote_event = false; // Whether a comma is needed before the next event
+static unsigned long long origin_ns = 0;
+
+#ifdef TRACE_WRITER_THREAD
+static pthread_t writer;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t changed = PTHREAD_COND_INITIALIZER;
+static int pending_chunk = -1; // Chunk waiting for the writer (-1 = none)
+static int pending_count = 0;
+static bool stopping = false;
+#endif
+
+static void write_json_string(FILE *file, const char *text)
+{
+    fputc('"', file);
+    for (const char *c = text; *c; c++)
+    {
+        if (*c == '"' || *c == '\\')
+            fputc('\\', file);
+        if ((unsigned char)*c >= 0x20)
+            fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+static void write_events(const TraceEvent *events, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const TraceEvent *event = &events[i];
+        fprintf(trace_file, "%s{\"name\":", wrote_event ? ",\n" : "");
+        write_json_string(trace_file, event->name);
+        fprintf(trace_file, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":1",
+                event->phase, (event->timestamp_ns - origin_ns) / 1000.0);
+        if (event->detail[0] != '\0')
+        {
+            fprintf(trace_file, ",\"args\":{\"detail\":");
+            write_json_string(trace_file, event->detail);
+            fputc('}', trace_file);
+        }
+        fputc('}', trace_file);
+        wrote_event = true;
+    }
+}
+
+#ifdef TRACE_WRITER_THREAD
+static void *writer_main(void *unused)
+{
+    (void)unused;
+    pthread_mutex_lock(&lock);
+    for (;;)
+    {
+        while (pending_chunk < 0 && !stopping)
+            pthread_cond_wait(&changed, &lock);
+        if (pending_chunk < 0)
+            break; // Stopping with nothing left to write
+
+        int chunk = pending_chunk;
+        int count = pending_count;
+        pthread_mutex_unlock(&lock);
+        write_events(chunks[chunk], count);
+        pthread_mutex_lock(&lock);
+
+        pending_chunk = -1;
+        pthread_cond_broadcast(&changed);
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+#endif
+
+// Hand the filled chunk to the writer and continue in the other one
+static void flush_chunk(void)
+{
+    if (fill_count == 0)
+        return;
+
+#ifdef TRACE_WRITER_THREAD
+    pthread_mutex_lock(&lock);
+    while (pending_chunk >= 0)
+        pthread_cond_wait(&changed, &lock); // Writer still busy with the other chunk
+    pending_chunk = fill_chunk;
+    pending_count = fill_count;
+    pthread_cond_broadcast(&changed);
+    pthread_mutex_unlock(&lock);
+#else
+    write_events(chunks[fill_chunk], fill_count);
+#endif
+
+    fill_chunk = 1 - fill_chunk;
+    fill_count = 0;
+}
+
+static void record(const char *name, const char *detail, char phase)
+{
+    if (!active)
+        return;
+
+    TraceEvent *event = &chunks[fill_chunk][fill_count];
+    event->name = name;
+    event->phase = phase;
+    event->timestamp_ns = sim_clock_ns();
+    if (detail)
+    {
+        strncpy(event->detail, detail, TRACE_DETAIL_LENGTH - 1);
+        event->detail[TRACE_DETAIL_LENGTH - 1] = '\0';
+    }
+    else
+    {
+        event->detail[0] = '\0';
+    }
+
+    if (++fill_count == TRACE_CHUNK_EVENTS)
+        flush_chunk();
+}
+
+bool trace_start(const char *path)
+{
+    if (active)
+        return true;
+
+    trace_file = fopen(path, "w");
+    if (!trace_file)
+        return false;
+
+    fprintf(trace_file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fill_chunk = 0;
+    fill_count = 0;
+    wrote_event = false;
+    origin_ns = sim_clock_ns();
+
+#ifdef TRACE_WRITER_THREAD
+    stopping = false;
+    pending_chunk = -1;
+    if (pthread_create(&writer, NULL, writer_main, NULL) != 0)
+    {
+        fclose(trace_file);
+        trace_file = NULL;
+        return false;
+    }
+#endif
+
+    active = true;
+    return true;
+}
+
+void trace_stop(void)
+{
+    if (!active)
+        return;
+
+    active = false;
+    flush_chunk();
+
+#ifdef TRACE_WRITER_THREAD
+    pthread_mutex_lock(&lock);
+    stopping = true;
+    pthread_cond_broadcast(&changed);
+    pthread_mutex_unlock(&lock);
+    pthread_join(writer, NULL); // Drains the last pending chunk first
+#endif
+
+    fprintf(trace_file, "\n]}\n");
+    fclose(trace_file);
+    trace_file = NULL;
+}
+
+bool trace_is_active(void)
+{
+    return active;
+}
+
+void trace_begin(const char *name, const char *detail)
+{
+    record(name, detail, 'B');
+}
+
+void trace_end(const char *name)
+{
+    record(name, NULL, 'E');
+}
@@ -0,0 +1,156 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include headers for testing
+#include "../include/background.h"
+#include "../include/config.h"
+
+// Only background_update is exercised here: it resolves the visible range and
+// the look-ahead, so cache behaviour can be checked without drawing.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_equal_int(const char *test_name, int expected, int actual, const char *message)
+{
+    test_assert(test_name, expected == actual, message);
+    if (expected != actual)
+    {
+        printf("  Expected: %d, Actual: %d\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ HELPERS ============
+
+#define STEP (1.0f / 60.0f)
+
+// Scroll the camera at a constant velocity for the given number of frames
+static float scroll(Background *bg, float x, float velocity, int frames)
+{
+    for (int i = 0; i < frames; i++)
+    {
+        x += velocity * STEP;
+        background_update(bg, (Vector2){x, 0}, (Vector2){velocity, 0});
+    }
+    return x;
+}
+
+// ============ TESTS ============
+
+void test_steady_scroll_never_regenerates()
+{
+    printf("\n--- Test Suite 1: Steady Scrolling ---\n");
+
+    Background bg = background_create();
+    background_update(&bg, (Vector2){0, 0}, (Vector2){PLAYER_SPEED, 0});
+    int initial_misses = bg.stats.chunk_misses;
+    test_assert_equal_int("steady_scroll", bg.chunk_radius * 2 + 1 + 2, initial_misses,
+                          "First update generates the visible range plus look-ahead");
+
+    // Cross ten chunks at walking speed
+    float x = scroll(&bg, 0, PLAYER_SPEED, (int)(10 * CHUNK_WIDTH / (PLAYER_SPEED * STEP)));
+    int chunks_crossed = (int)(x / CHUNK_WIDTH);
+
+    test_assert_equal_int("steady_scroll", initial_misses + chunks_crossed, bg.stats.chunk_misses,
+                          "Exactly one new chunk is generated per chunk crossed");
+    test_assert("steady_scroll", bg.stats.chunk_hits > bg.stats.chunk_misses, "Most lookups are cache hits");
+
+    background_cleanup(&bg);
+}
+
+void test_reversing_hits_cached_chunks()
+{
+    printf("\n--- Test Suite 2: Direction Reversal ---\n");
+
+    Background bg = background_create();
+    float x = scroll(&bg, 0, PLAYER_SPEED, 600);
+
+    int misses = bg.stats.chunk_misses;
+    background_update(&bg, (Vector2){x, 0}, (Vector2){-PLAYER_SPEED, 0});
+    test_assert_equal_int("reversal", misses, bg.stats.chunk_misses,
+                          "Chunks just scrolled past are still cached when turning around");
+
+    background_cleanup(&bg);
+}
+
+void test_negative_positions()
+{
+    printf("\n--- Test Suite 3: Negative Positions ---\n");
+
+    Background bg = background_create();
+    float x = scroll(&bg, 0, -PLAYER_SPEED, 1200);
+    int misses = bg.stats.chunk_misses;
+    int cloud_misses = bg.stats.cloud_misses;
+
+    // Standing still left of the origin must be served entirely from the cache
+    background_update(&bg, (Vector2){x, 0}, (Vector2){0, 0});
+    test_assert_equal_int("negative", misses, bg.stats.chunk_misses, "No chunk misses while idle");
+    test_assert_equal_int("negative", cloud_misses, bg.stats.cloud_misses, "No cloud misses while idle");
+
+    int center = (int)floorf(x / CHUNK_WIDTH);
+    int found = 0;
+    for (int i = 0; i < bg.max_chunks; i++)
+    {
+        if (bg.chunks[i].generated && bg.chunks[i].chunk_index == center)
+        {
+            found = 1;
+        }
+    }
+    test_assert("negative", found, "Negative chunk indices are cached");
+
+    background_cleanup(&bg);
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║     BACKGROUND CACHE TEST SUITE        ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_steady_scroll_never_regenerates();
+    test_reversing_hits_cached_chunks();
+    test_negative_positions();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
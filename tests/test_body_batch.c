@@ -0,0 +1,274 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Include headers for testing
+#include "../include/body_batch.h"
+#include "../include/config.h"
+
+// The batch integrator must give bit-for-bit the results of integrating one body at a time,
+// whichever vector kernel it was built with, for any body count (full and partial groups),
+// and those results must be the hand-computed ones. Bodies despawn by their distance from
+// the view, wherever the camera is in the level.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_equal_int(const char *test_name, int expected, int actual, const char *message)
+{
+    test_assert(test_name, expected == actual, message);
+    if (expected != actual)
+    {
+        printf("  Expected: %d, Actual: %d\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ HELPERS ============
+
+typedef struct
+{
+    Vector2 position;
+    Vector2 velocity;
+    float rotation;
+    float lifetime;
+    bool grounded;
+    bool expired;
+} Body;
+
+// One body at a time, the way the entity update functions used to do it
+static void integrate_one(Body *body, const BodyKind *kind, float camera_x, float delta_time)
+{
+    if (!body->grounded)
+    {
+        body->velocity.y += kind->gravity * delta_time;
+        if (body->position.y >= kind->ground_y)
+        {
+            body->position.y = kind->ground_y;
+            body->velocity.y = 0;
+            body->grounded = true;
+        }
+    }
+
+    body->position.x += body->velocity.x * delta_time;
+    body->position.y += body->velocity.y * delta_time;
+    body->rotation += kind->spin * delta_time;
+    body->lifetime -= delta_time;
+
+    float min_x = camera_x - VIEW_WIDTH / 2.0f - 1000.0f;
+    float max_x = camera_x + VIEW_WIDTH / 2.0f + 1000.0f;
+    body->expired = body->lifetime <= 0.0f || body->position.x < min_x || body->position.x > max_x ||
+                    body->position.y > kind->despawn_y;
+}
+
+static float random_range(float min, float max)
+{
+    return min + (max - min) * ((float)rand() / (float)RAND_MAX);
+}
+
+static Body random_body(float camera_x)
+{
+    Body body = {0};
+    body.position = (Vector2){camera_x + random_range(-2500.0f, 2500.0f), random_range(200.0f, 720.0f)};
+    body.velocity = (Vector2){random_range(-400.0f, 400.0f), random_range(-300.0f, 300.0f)};
+    body.rotation = random_range(0.0f, 360.0f);
+    body.lifetime = random_range(-0.01f, 0.05f);
+    body.grounded = rand() % 4 == 0;
+    return body;
+}
+
+// Run count random bodies through the batch and the reference for a few steps
+static bool matches_reference(const BodyKind *kind, int count, int steps)
+{
+    float camera_x = random_range(0.0f, 50000.0f);
+    Body *bodies = (Body *)malloc(sizeof(Body) * count);
+    for (int i = 0; i < count; i++)
+    {
+        bodies[i] = random_body(camera_x);
+    }
+
+    BodyBatch batch = body_batch_create(0);
+    bool same = true;
+    for (int step = 0; step < steps && same; step++)
+    {
+        body_batch_begin(&batch, count);
+        for (int i = 0; i < count; i++)
+        {
+            body_batch_add(&batch, i, bodies[i].position, bodies[i].velocity, bodies[i].rotation,
+                           bodies[i].lifetime, bodies[i].grounded);
+        }
+        body_batch_integrate(&batch, kind, camera_x, SIMULATION_DT);
+
+        int expired = 0;
+        for (int i = 0; i < count; i++)
+        {
+            integrate_one(&bodies[i], kind, camera_x, SIMULATION_DT);
+            same = same && memcmp(&batch.x[i], &bodies[i].position.x, sizeof(float)) == 0 &&
+                   memcmp(&batch.y[i], &bodies[i].position.y, sizeof(float)) == 0 &&
+                   memcmp(&batch.velocity_y[i], &bodies[i].velocity.y, sizeof(float)) == 0 &&
+                   memcmp(&batch.rotation[i], &bodies[i].rotation, sizeof(float)) == 0 &&
+                   memcmp(&batch.lifetime[i], &bodies[i].lifetime, sizeof(float)) == 0 &&
+                   (batch.grounded[i] != 0) == bodies[i].grounded;
+            if (bodies[i].expired)
+            {
+                // Expired indices come out in ascending order
+                same = same && expired < batch.expired_count && batch.expired[expired] == i;
+                expired++;
+            }
+        }
+        same = same && expired == batch.expired_count;
+    }
+
+    body_batch_cleanup(&batch);
+    free(bodies);
+    return same;
+}
+
+// ============ BATCH TESTS ============
+
+void test_matches_single_body_update()
+{
+    const BodyKind falling = {300.0f, 5.0f, GROUND_Y, INFINITY};
+    const BodyKind arcing = {300.0f, 5.0f, INFINITY, 700.0f};
+    const BodyKind straight = {0.0f, 0.0f, INFINITY, INFINITY};
+
+    srand(11);
+    int counts[] = {0, 1, 3, 4, 7, 8, 9, 31, 1000};
+    for (int c = 0; c < (int)(sizeof(counts) / sizeof(counts[0])); c++)
+    {
+        char message[64];
+        snprintf(message, sizeof(message), "%d bodies match one-at-a-time", counts[c]);
+        test_assert("falling", matches_reference(&falling, counts[c], 8), message);
+        test_assert("arcing", matches_reference(&arcing, counts[c], 8), message);
+        test_assert("straight", matches_reference(&straight, counts[c], 8), message);
+    }
+}
+
+void test_source_indices()
+{
+    // Only some bodies are copied in: expired entries name the original indices
+    const BodyKind straight = {0.0f, 0.0f, INFINITY, INFINITY};
+    BodyBatch batch = body_batch_create(2);
+    body_batch_begin(&batch, 3);
+    body_batch_add(&batch, 4, (Vector2){600, 300}, (Vector2){0, 0}, 0.0f, 1.0f, false);
+    body_batch_add(&batch, 9, (Vector2){600, 300}, (Vector2){0, 0}, 0.0f, 0.0f, false);
+    body_batch_add(&batch, 12, (Vector2){-5000, 300}, (Vector2){0, 0}, 0.0f, 1.0f, false);
+    body_batch_integrate(&batch, &straight, 600.0f, SIMULATION_DT);
+
+    test_assert_equal_int("source", 2, batch.expired_count, "Two bodies expired");
+    test_assert("source", batch.expired_count == 2 && batch.expired[0] == 9 && batch.expired[1] == 12,
+                "Expired entries are list indices");
+    body_batch_cleanup(&batch);
+}
+
+void test_hand_computed_step()
+{
+    // Nine copies, so the vector kernels and the scalar tail all see the same bodies
+    const BodyKind falling = {300.0f, 5.0f, GROUND_Y, INFINITY};
+    BodyBatch batch = body_batch_create(18);
+    body_batch_begin(&batch, 18);
+    for (int i = 0; i < 9; i++)
+    {
+        body_batch_add(&batch, i, (Vector2){100, 200}, (Vector2){60, -120}, 0.0f, 1.0f, false);
+        body_batch_add(&batch, 9 + i, (Vector2){40, GROUND_Y + 5.0f}, (Vector2){0, 50}, 0.0f, 1.0f, false);
+    }
+    body_batch_integrate(&batch, &falling, 0.0f, 1.0f / 120.0f);
+
+    bool flying = true;
+    bool landed = true;
+    for (int b = 0; b < batch.count; b++)
+    {
+        if (batch.source[b] < 9)
+        {
+            // vy = -120 + 300/120 = -117.5; x = 100 + 60/120; y = 200 - 117.5/120
+            flying = flying && fabsf(batch.velocity_y[b] - -117.5f) <= 1e-4f && fabsf(batch.x[b] - 100.5f) <= 1e-4f &&
+                     fabsf(batch.y[b] - 199.020833f) <= 1e-4f && fabsf(batch.rotation[b] - 0.0416667f) <= 1e-5f &&
+                     fabsf(batch.lifetime[b] - 0.9916667f) <= 1e-5f && batch.grounded[b] == 0;
+        }
+        else
+        {
+            // Below the ground: snapped onto it and stopped
+            landed = landed && batch.y[b] == GROUND_Y && batch.velocity_y[b] == 0.0f && batch.x[b] == 40.0f &&
+                     batch.grounded[b] == 1;
+        }
+    }
+    test_assert("hand", flying, "A falling body moves, spins and ages by the hand-computed amounts");
+    test_assert("hand", landed, "A body below the ground lands on it");
+    test_assert_equal_int("hand", 0, batch.expired_count, "Nothing expired");
+    body_batch_cleanup(&batch);
+}
+
+void test_despawn_follows_camera()
+{
+    // Far down a long level: on screen stays, more than 1000 outside the view expires
+    const BodyKind straight = {0.0f, 0.0f, INFINITY, INFINITY};
+    float camera_x = 20000.0f;
+    BodyBatch batch = body_batch_create(9);
+    body_batch_begin(&batch, 9);
+    for (int i = 0; i < 6; i++)
+    {
+        body_batch_add(&batch, i, (Vector2){camera_x - 600.0f + 200.0f * i, 300}, (Vector2){0, 0}, 0.0f, 1.0f, false);
+    }
+    body_batch_add(&batch, 6, (Vector2){camera_x + VIEW_WIDTH / 2.0f + 999.0f, 300}, (Vector2){0, 0}, 0.0f, 1.0f, false);
+    body_batch_add(&batch, 7, (Vector2){camera_x - VIEW_WIDTH / 2.0f - 1001.0f, 300}, (Vector2){0, 0}, 0.0f, 1.0f, false);
+    body_batch_add(&batch, 8, (Vector2){camera_x + VIEW_WIDTH / 2.0f + 1001.0f, 300}, (Vector2){0, 0}, 0.0f, 1.0f, false);
+    body_batch_integrate(&batch, &straight, camera_x, SIMULATION_DT);
+
+    test_assert_equal_int("camera", 2, batch.expired_count, "Only the two bodies past the margin expire");
+    test_assert("camera", batch.expired_count == 2 && batch.expired[0] == 7 && batch.expired[1] == 8,
+                "On-screen bodies far from the level start stay");
+    body_batch_cleanup(&batch);
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║       BODY BATCH TEST SUITE            ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_matches_single_body_update();
+    test_source_indices();
+    test_hand_computed_step();
+    test_despawn_follows_camera();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,251 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include headers for testing
+#include "../include/broadphase.h"
+
+// The broadphase must report exactly the pairs a brute-force check over every box finds,
+// restricted by the layer masks, however the boxes move between updates.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_equal_int(const char *test_name, int expected, int actual, const char *message)
+{
+    test_assert(test_name, expected == actual, message);
+    if (expected != actual)
+    {
+        printf("  Expected: %d, Actual: %d\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ HELPERS ============
+
+#define BOX_COUNT 200
+#define WORLD_WIDTH 4000.0f
+
+typedef struct
+{
+    Rectangle rect;
+    float velocity;
+    unsigned int layer;
+    unsigned int mask;
+    bool enabled;
+} TestBox;
+
+static bool boxes_touch(Rectangle a, Rectangle b)
+{
+    return a.x <= b.x + b.width && b.x <= a.x + a.width && a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+static bool wants_pair(const TestBox *a, const TestBox *b)
+{
+    return (a->mask & b->layer) != 0 || (b->mask & a->layer) != 0;
+}
+
+static float random_range(float min, float max)
+{
+    return min + (max - min) * (float)rand() / (float)RAND_MAX;
+}
+
+// Half the boxes are monsters, a quarter player shots that hit monsters, the rest pickups
+static void make_boxes(TestBox *boxes, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        TestBox *box = &boxes[i];
+        box->rect = (Rectangle){random_range(0, WORLD_WIDTH), random_range(300, 600), random_range(10, 80), random_range(10, 80)};
+        box->velocity = random_range(-400, 400);
+        box->enabled = true;
+        if (i % 4 < 2)
+        {
+            box->layer = COLLISION_LAYER_MONSTER;
+            box->mask = 0;
+        }
+        else if (i % 4 == 2)
+        {
+            box->layer = COLLISION_LAYER_PLAYER_SHOT;
+            box->mask = COLLISION_LAYER_MONSTER;
+        }
+        else
+        {
+            box->layer = COLLISION_LAYER_PICKUP;
+            box->mask = 0;
+        }
+    }
+}
+
+static int brute_force_pair_count(const TestBox *boxes, int count)
+{
+    int pairs = 0;
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = i + 1; j < count; j++)
+        {
+            if (boxes[i].enabled && boxes[j].enabled && wants_pair(&boxes[i], &boxes[j]) &&
+                boxes_touch(boxes[i].rect, boxes[j].rect))
+                pairs++;
+        }
+    }
+    return pairs;
+}
+
+static void sync(Broadphase *broadphase, const TestBox *boxes, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (boxes[i].enabled)
+            broadphase_set(broadphase, BROADPHASE_MONSTER, i, boxes[i].rect, boxes[i].layer, boxes[i].mask);
+        else
+            broadphase_disable(broadphase, BROADPHASE_MONSTER, i);
+    }
+}
+
+// Every reported pair must be real and allowed by the masks
+static bool pairs_are_valid(const Broadphase *broadphase, const TestBox *boxes)
+{
+    for (int i = 0; i < broadphase->pair_count; i++)
+    {
+        const TestBox *a = &boxes[broadphase->proxies[broadphase->pairs[i].a].index];
+        const TestBox *b = &boxes[broadphase->proxies[broadphase->pairs[i].b].index];
+        if (!a->enabled || !b->enabled || !wants_pair(a, b) || !boxes_touch(a->rect, b->rect))
+            return false;
+    }
+    return true;
+}
+
+// ============ TESTS ============
+
+void test_matches_brute_force()
+{
+    printf("\n--- Test Suite 1: Pairs Match Brute Force ---\n");
+
+    srand(1234);
+    TestBox boxes[BOX_COUNT];
+    make_boxes(boxes, BOX_COUNT);
+
+    Broadphase broadphase = broadphase_create(16);
+    bool counts_match = true;
+    bool all_valid = true;
+    for (int tick = 0; tick < 120; tick++)
+    {
+        for (int i = 0; i < BOX_COUNT; i++)
+        {
+            boxes[i].rect.x += boxes[i].velocity / 120.0f;
+            boxes[i].enabled = (i + tick / 30) % 7 != 0; // Toggle a few on and off
+        }
+        sync(&broadphase, boxes, BOX_COUNT);
+        int found = broadphase_find_pairs(&broadphase);
+        counts_match = counts_match && found == brute_force_pair_count(boxes, BOX_COUNT);
+        all_valid = all_valid && pairs_are_valid(&broadphase, boxes);
+    }
+
+    test_assert("brute_force", counts_match, "Same number of pairs as the O(n^2) check on every tick");
+    test_assert("brute_force", all_valid, "Every reported pair overlaps and passes the masks");
+    broadphase_cleanup(&broadphase);
+}
+
+void test_masks_filter_pairs()
+{
+    printf("\n--- Test Suite 2: Layer Masks ---\n");
+
+    Broadphase broadphase = broadphase_create(4);
+    Rectangle same_spot = {100, 100, 50, 50};
+    broadphase_set(&broadphase, BROADPHASE_MONSTER, 0, same_spot, COLLISION_LAYER_MONSTER, 0);
+    broadphase_set(&broadphase, BROADPHASE_PICKUP, 0, same_spot, COLLISION_LAYER_PICKUP, 0);
+    test_assert_equal_int("masks", 0, broadphase_find_pairs(&broadphase), "Layers nobody asked for never pair");
+
+    broadphase_set(&broadphase, BROADPHASE_PLAYER, 0, same_spot, COLLISION_LAYER_PLAYER, COLLISION_LAYER_PICKUP);
+    test_assert_equal_int("masks", 1, broadphase_find_pairs(&broadphase), "Player pairs with the pickup only");
+
+    broadphase_cleanup(&broadphase);
+}
+
+void test_collect_is_sorted()
+{
+    printf("\n--- Test Suite 3: Collected Hits ---\n");
+
+    // Shots listed right to left so the sweep finds them in reverse index order
+    Broadphase broadphase = broadphase_create(4);
+    for (int m = 0; m < 3; m++)
+    {
+        broadphase_set(&broadphase, BROADPHASE_MONSTER, m, (Rectangle){0, 0, 100, 100}, COLLISION_LAYER_MONSTER, 0);
+    }
+    for (int p = 0; p < 3; p++)
+    {
+        broadphase_set(&broadphase, BROADPHASE_PROJECTILE, p, (Rectangle){90.0f - p * 40.0f, 50, 10, 10},
+                       COLLISION_LAYER_PLAYER_SHOT, COLLISION_LAYER_MONSTER);
+    }
+    broadphase_find_pairs(&broadphase);
+
+    int count = broadphase_collect(&broadphase, BROADPHASE_PROJECTILE, COLLISION_LAYER_PLAYER_SHOT,
+                                   BROADPHASE_MONSTER, COLLISION_LAYER_MONSTER, false);
+    test_assert_equal_int("collect", 9, count, "Every shot overlaps every monster");
+    bool sorted = true;
+    for (int i = 1; i < count; i++)
+    {
+        const BroadphaseHit *a = &broadphase.hits[i - 1];
+        const BroadphaseHit *b = &broadphase.hits[i];
+        sorted = sorted && (a->first < b->first || (a->first == b->first && a->second < b->second));
+    }
+    test_assert("collect", sorted, "Hits come back in nested-loop order");
+
+    count = broadphase_collect(&broadphase, BROADPHASE_PROJECTILE, COLLISION_LAYER_PLAYER_SHOT,
+                               BROADPHASE_MONSTER, COLLISION_LAYER_MONSTER, true);
+    test_assert_equal_int("collect", 3, count, "unique_first keeps one hit per shot");
+
+    broadphase_cleanup(&broadphase);
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║       BROADPHASE TEST SUITE            ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_matches_brute_force();
+    test_masks_filter_pairs();
+    test_collect_is_sorted();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
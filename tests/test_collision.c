@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include headers for testing
+#include "../include/collision.h"
+
+// Swept checks must catch fast boxes that pass clean through a target between two ticks,
+// and agree with the plain overlap test whenever the boxes overlap at the end of the step.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_equal_int(const char *test_name, int expected, int actual, const char *message)
+{
+    test_assert(test_name, expected == actual, message);
+    if (expected != actual)
+    {
+        printf("  Expected: %d, Actual: %d\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ SWEEP TESTS ============
+
+void test_fast_box_does_not_tunnel()
+{
+    // A 4px shot moving 100px in one step, across a 10px wall it never overlaps at either end
+    Rectangle shot_from = {0, 20, 4, 4};
+    Rectangle shot_to = {100, 20, 4, 4};
+    Rectangle wall = {50, 0, 10, 50};
+    float time_of_impact = -1.0f;
+
+    test_assert("tunnel", !CheckCollisionRecs(shot_to, wall), "End positions alone miss the wall");
+    test_assert("tunnel", collision_sweep(shot_from, shot_to, wall, wall, &time_of_impact),
+                "Sweep finds the wall in between");
+    test_assert("tunnel", time_of_impact > 0.45f && time_of_impact < 0.47f, "Impact at 46% of the step");
+
+    Rectangle high_wall = {50, 40, 10, 50};
+    test_assert("tunnel", !collision_sweep(shot_from, shot_to, high_wall, high_wall, &time_of_impact),
+                "A wall off the path is not hit");
+}
+
+void test_relative_motion()
+{
+    // Both boxes move right at the same speed: they never get closer
+    Rectangle a_from = {0, 0, 10, 10};
+    Rectangle a_to = {100, 0, 10, 10};
+    Rectangle b_from = {20, 0, 10, 10};
+    Rectangle b_to = {120, 0, 10, 10};
+    float time_of_impact;
+    test_assert("relative", !collision_sweep(a_from, a_to, b_from, b_to, &time_of_impact),
+                "Boxes moving together never meet");
+
+    // Moving towards each other they meet half way through their gap
+    b_from = (Rectangle){110, 0, 10, 10};
+    b_to = (Rectangle){10, 0, 10, 10};
+    test_assert("relative", collision_sweep(a_from, a_to, b_from, b_to, &time_of_impact),
+                "Boxes moving towards each other meet");
+    test_assert("relative", time_of_impact > 0.49f && time_of_impact < 0.51f, "They meet at half the step");
+}
+
+void test_agrees_with_overlap()
+{
+    // Every end overlap CheckCollisionRecs reports must be a swept hit too
+    srand(7);
+    int disagreements = 0;
+    for (int i = 0; i < 2000; i++)
+    {
+        Rectangle a_from = {(float)(rand() % 200), (float)(rand() % 200), 5.0f + rand() % 30, 5.0f + rand() % 30};
+        Rectangle a_to = {(float)(rand() % 200), (float)(rand() % 200), a_from.width, a_from.height};
+        Rectangle b = {(float)(rand() % 200), (float)(rand() % 200), 5.0f + rand() % 30, 5.0f + rand() % 30};
+        float time_of_impact;
+        if (CheckCollisionRecs(a_to, b) && !collision_sweep(a_from, a_to, b, b, &time_of_impact))
+            disagreements++;
+    }
+    test_assert_equal_int("overlap", 0, disagreements, "No end overlap is missed");
+
+    Rectangle bounds = collision_sweep_bounds((Rectangle){10, 40, 5, 5}, (Rectangle){-20, 0, 5, 5});
+    test_assert("bounds", bounds.x == -20 && bounds.y == 0 && bounds.width == 35 && bounds.height == 45,
+                "Bounds cover both ends of the move");
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║       COLLISION TEST SUITE             ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_fast_box_does_not_tunnel();
+    test_relative_motion();
+    test_agrees_with_overlap();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
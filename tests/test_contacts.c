@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Include headers for testing
+#include "../include/contacts.h"
+#include "../include/config.h"
+
+// The pipeline must keep exactly the candidates the test accepts, in (category, first,
+// second) order, with their time of impact, and give the same contacts whether the jobs ran
+// on one thread or were spread over several.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ TEST WORLD ============
+
+// Accepts a pair when (first * 7 + second + category) is a multiple of 3, with a time of
+// impact made from the indices
+static bool test_pair(void *context, ContactCategory category, BroadphaseHit candidate, float *time_of_impact)
+{
+    (void)context;
+    if ((candidate.first * 7 + candidate.second + (int)category) % 3 != 0)
+        return false;
+    *time_of_impact = (float)((candidate.first + candidate.second) % 10) / 10.0f;
+    return true;
+}
+
+static bool expected_contact(ContactCategory category, int first, int second)
+{
+    return (first * 7 + second + (int)category) % 3 == 0;
+}
+
+// Candidates for every category, added last category first and in descending order, so the
+// pipeline has to sort them
+static void add_candidates(ContactPipeline *pipeline, int per_category)
+{
+    BroadphaseHit *hits = malloc(sizeof(BroadphaseHit) * per_category);
+    contact_pipeline_begin(pipeline);
+    for (int c = CONTACT_CATEGORY_COUNT - 1; c >= 0; c--)
+    {
+        for (int i = 0; i < per_category; i++)
+        {
+            hits[i].first = (per_category - 1 - i) / 4;
+            hits[i].second = (per_category - 1 - i) % 4;
+        }
+        contact_pipeline_add_candidates(pipeline, (ContactCategory)c, hits, per_category);
+    }
+    free(hits);
+}
+
+static bool contacts_sorted(const ContactPipeline *pipeline)
+{
+    for (int i = 1; i < pipeline->count; i++)
+    {
+        const Contact *a = &pipeline->contacts[i - 1];
+        const Contact *b = &pipeline->contacts[i];
+        if (a->category != b->category)
+        {
+            if (a->category > b->category)
+                return false;
+        }
+        else if (a->first != b->first ? a->first > b->first : a->second >= b->second)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============ TESTS ============
+
+static void test_small_run(void)
+{
+    ContactPipeline pipeline = contact_pipeline_create(1);
+    int context = 0;
+
+    add_candidates(&pipeline, 8);
+    int count = contact_pipeline_run(&pipeline, test_pair, &context);
+
+    int expected = 0;
+    for (int c = 0; c < CONTACT_CATEGORY_COUNT; c++)
+        for (int i = 0; i < 8; i++)
+            expected += expected_contact((ContactCategory)c, i / 4, i % 4);
+
+    test_assert("small", count == expected, "Every accepted candidate gives a contact");
+    test_assert("small", pipeline.count == count, "The count is kept on the pipeline");
+    test_assert("small", contacts_sorted(&pipeline), "Contacts come out by category, then first, then second");
+
+    bool all_expected = true;
+    bool impacts = true;
+    for (int i = 0; i < pipeline.count; i++)
+    {
+        const Contact *contact = &pipeline.contacts[i];
+        all_expected = all_expected && expected_contact(contact->category, contact->first, contact->second);
+        impacts = impacts && contact->time_of_impact == (float)((contact->first + contact->second) % 10) / 10.0f;
+    }
+    test_assert("small", all_expected, "Rejected candidates give no contact");
+    test_assert("small", impacts, "The time of impact is passed through");
+
+    contact_pipeline_begin(&pipeline);
+    test_assert("small", contact_pipeline_run(&pipeline, test_pair, &context) == 0, "No candidates, no contacts");
+
+    contact_pipeline_cleanup(&pipeline);
+}
+
+static void test_threads_match_single(void)
+{
+    // Enough candidates per category that the run is spread over the threads
+    int per_category = CONTACT_PARALLEL_MIN;
+    ContactPipeline single = contact_pipeline_create(1);
+    ContactPipeline threaded = contact_pipeline_create(CONTACT_THREADS);
+    int context = 0;
+
+    bool same = true;
+    for (int run = 0; run < 20; run++)
+    {
+        add_candidates(&single, per_category + run);
+        add_candidates(&threaded, per_category + run);
+        int single_count = contact_pipeline_run(&single, test_pair, &context);
+        int threaded_count = contact_pipeline_run(&threaded, test_pair, &context);
+        same = same && single_count == threaded_count && single_count > 0 &&
+               memcmp(single.contacts, threaded.contacts, sizeof(Contact) * single_count) == 0;
+    }
+    test_assert("threads", same, "Twenty threaded runs give exactly the single thread's contacts");
+    test_assert("threads", contacts_sorted(&threaded), "Threaded contacts are sorted");
+
+    contact_pipeline_cleanup(&single);
+    contact_pipeline_cleanup(&threaded);
+}
+
+static void test_cleanup_twice(void)
+{
+    ContactPipeline pipeline = contact_pipeline_create(CONTACT_THREADS);
+    contact_pipeline_cleanup(&pipeline);
+    contact_pipeline_cleanup(&pipeline);
+    test_assert("cleanup", pipeline.workers == NULL && pipeline.contacts == NULL, "Cleanup stops the threads and can run twice");
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║     CONTACT PIPELINE TEST SUITE        ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_small_run();
+    test_threads_match_single();
+    test_cleanup_twice();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Include headers for testing
+#include "../include/game_events.h"
+
+// Events must come out in the order they were pushed with what was pushed, the queue must
+// grow past its starting capacity without losing any, and clearing must empty it for the
+// next tick.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ TESTS ============
+
+static void test_push_order(void)
+{
+    GameEventQueue queue = game_event_queue_create(4);
+
+    game_event_push(&queue, GAME_EVENT_MONSTER_KILLED, 3);
+    PlayerHit hit = {2, DAMAGE_TYPE_DUST, 1.5f, COLLISION_TYPE_HAZARD, true};
+    game_event_push_player_hit(&queue, hit);
+    game_event_push(&queue, GAME_EVENT_PROJECTILE_EXPIRED, 7);
+
+    test_assert("order", queue.count == 3, "Three events queued");
+    test_assert("order", queue.events[0].type == GAME_EVENT_MONSTER_KILLED && queue.events[0].index == 3, "First in, first out");
+    test_assert("order", queue.events[1].type == GAME_EVENT_PLAYER_HIT, "The hit comes second");
+    test_assert("order", queue.events[1].hit.damage == 2 && queue.events[1].hit.damage_type == DAMAGE_TYPE_DUST &&
+                             queue.events[1].hit.collision_type == COLLISION_TYPE_HAZARD && queue.events[1].hit.contact,
+                "The hit keeps what was pushed");
+    test_assert("order", queue.events[2].type == GAME_EVENT_PROJECTILE_EXPIRED && queue.events[2].index == 7, "Then the projectile");
+    test_assert("order", queue.events[2].hit.damage == 0, "Other events carry no hit");
+
+    game_event_queue_cleanup(&queue);
+}
+
+static void test_growth(void)
+{
+    GameEventQueue queue = game_event_queue_create(1);
+    for (int i = 0; i < 100; i++)
+    {
+        game_event_push(&queue, GAME_EVENT_LOOT_COLLECTED, i);
+    }
+
+    bool in_order = true;
+    for (int i = 0; i < queue.count; i++)
+    {
+        in_order = in_order && queue.events[i].index == i;
+    }
+    test_assert("growth", queue.count == 100, "A hundred events fit in a queue made for one");
+    test_assert("growth", in_order, "None lost or reordered while growing");
+
+    game_event_queue_cleanup(&queue);
+    test_assert("growth", queue.events == NULL && queue.count == 0, "Cleanup frees the events");
+}
+
+static void test_clear(void)
+{
+    GameEventQueue queue = game_event_queue_create(2);
+    game_event_push(&queue, GAME_EVENT_PICKUP_COLLECTED, 0);
+    game_event_push(&queue, GAME_EVENT_PICKUP_COLLECTED, 1);
+    game_event_queue_clear(&queue);
+
+    test_assert("clear", queue.count == 0, "Clearing empties the queue");
+    game_event_push(&queue, GAME_EVENT_MONSTER_KILLED, 5);
+    test_assert("clear", queue.count == 1 && queue.events[0].index == 5, "The next tick starts from the front");
+
+    game_event_queue_cleanup(&queue);
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║     GAME EVENT QUEUE TEST SUITE        ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_push_order();
+    test_growth();
+    test_clear();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Include headers for testing
+#include "../include/game.h"
+#include "../include/monster.h"
+#include "../include/asset_paths.h"
+#include "../include/config.h"
+
+// The order game_step resolves the collisions of one tick in: every sword contact before every
+// player-monster contact (so a monster the sword kills never touches the player, wherever it
+// is in the list), one sword hit per swing on the lowest-index monster, and at most one contact
+// hit on the player per tick.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ TEST SCENE ============
+
+// High above the first level, where nothing of its own can reach. The player is 40 x 60 and
+// the sword reaches 30 past its right edge.
+#define SCENE_Y -5000.0f
+
+typedef struct
+{
+    GameState state;
+    SlotHandle added[4];
+    int added_count;
+} Scene;
+
+// Restart the first level with the player in the scene, swinging or not. The world stays
+// paused, so nothing moves and game_step only runs the collision checks on what is set here.
+static void scene_start(Scene *scene, bool swinging)
+{
+    GameState *state = &scene->state;
+    game_sim_start_level(state, 0);
+    scene->added_count = 0;
+
+    Player *player = &state->player;
+    player->position = (Vector2){state->levels[0].player_start_position.x, SCENE_Y};
+    player->previous_position = player->position;
+    player->width = 40.0f;
+    player->height = 60.0f;
+    player->protection_potion_active = false;
+    player->is_using_sword = swinging;
+    player->sword_hitbox = (Rectangle){player->position.x + 40.0f, SCENE_Y + 10.0f, 30.0f, 40.0f};
+    state->is_paused = true;
+    state->last_collision_type = COLLISION_TYPE_NONE;
+}
+
+// A still monster at (dx, dy) from the player; returns its index in the level's list
+static int scene_add_monster(Scene *scene, float dx, float dy, int hearts)
+{
+    GameState *state = &scene->state;
+    MonsterList *monsters = &state->levels[0].monsters;
+    Vector2 origin = state->player.position;
+    Monster monster = monster_create(origin.x + dx, origin.y + dy, 20.0f, 20.0f, hearts,
+                                     origin.x + dx, origin.x + dx, 0.0f, MONSTER_SLUG, 1.0f);
+    scene->added[scene->added_count++] = monster_list_add(monsters, monster);
+    return monsters->count - 1;
+}
+
+static void scene_step(Scene *scene)
+{
+    PlayerInput input = {0};
+    game_step(&scene->state, &input, SIMULATION_DT);
+}
+
+// Take the added monsters out of the level again
+static void scene_end(Scene *scene)
+{
+    for (int i = 0; i < scene->added_count; i++)
+        monster_list_remove(&scene->state.levels[0].monsters, scene->added[i]);
+    scene->added_count = 0;
+}
+
+// Where each monster sits: touching only the player, under only the sword, or under both
+#define AT_PLAYER 5.0f, 5.0f
+#define AT_SWORD 50.0f, 10.0f
+#define AT_BOTH 30.0f, 10.0f
+
+// ============ TESTS ============
+
+static void test_sword_kill_prevents_touch(Scene *scene)
+{
+    scene_start(scene, true);
+    int hearts = scene->state.player.hearts;
+    int m = scene_add_monster(scene, AT_BOTH, 1);
+    scene_step(scene);
+
+    MonsterList *monsters = &scene->state.levels[0].monsters;
+    test_assert("sword first", !monsters->active[m], "The sword kills the monster it overlaps");
+    test_assert("sword first", scene->state.player.hearts == hearts, "The monster it killed does not touch the player");
+    test_assert("sword first", scene->state.last_collision_type == COLLISION_TYPE_NONE, "No hit is recorded");
+    scene_end(scene);
+}
+
+static void test_one_sword_hit_per_swing(Scene *scene)
+{
+    scene_start(scene, true);
+    int first = scene_add_monster(scene, AT_SWORD, 1);
+    int second = scene_add_monster(scene, AT_SWORD, 1);
+    scene_step(scene);
+
+    MonsterList *monsters = &scene->state.levels[0].monsters;
+    test_assert("one swing", !monsters->active[first], "The swing hits the lower-index monster");
+    test_assert("one swing", monsters->active[second] && monsters->hearts[second] == 1, "The other monster under the sword is untouched");
+    scene_end(scene);
+}
+
+static void test_touch_does_not_stop_later_sword(Scene *scene)
+{
+    // The monster touching the player comes first in the list; the sword still lands on the
+    // later one, as it did when the two were checked one monster at a time
+    scene_start(scene, true);
+    int hearts = scene->state.player.hearts;
+    int toucher = scene_add_monster(scene, AT_PLAYER, 1);
+    int target = scene_add_monster(scene, AT_SWORD, 1);
+    scene_step(scene);
+
+    MonsterList *monsters = &scene->state.levels[0].monsters;
+    test_assert("touch then sword", monsters->active[toucher], "The monster touching the player survives");
+    test_assert("touch then sword", !monsters->active[target], "The sword kills the monster after it");
+    test_assert("touch then sword", scene->state.player.hearts == hearts - 1, "The touch costs one heart");
+    test_assert("touch then sword", scene->state.last_collision_type == COLLISION_TYPE_MONSTER, "The hit is a monster hit");
+    scene_end(scene);
+}
+
+static void test_one_contact_hit_per_tick(Scene *scene)
+{
+    scene_start(scene, false);
+    int hearts = scene->state.player.hearts;
+    scene_add_monster(scene, AT_PLAYER, 3);
+    scene_add_monster(scene, AT_PLAYER, 3);
+    scene_add_monster(scene, AT_BOTH, 3);
+    scene_step(scene);
+
+    test_assert("one contact hit", scene->state.player.hearts == hearts - 1, "Three monsters touching the player cost one heart");
+    test_assert("one contact hit", scene->state.is_paused, "The hit pauses the game");
+
+    // Still touching on the next tick, but the cooldown the first hit started holds
+    scene_step(scene);
+    test_assert("one contact hit", scene->state.player.hearts == hearts - 1, "The cooldown keeps the next tick from hitting again");
+    scene_end(scene);
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║     GAME SIMULATION TEST SUITE         ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    SetTraceLogLevel(LOG_WARNING);
+    init_asset_paths();
+    texture_cache_set_headless(true);
+
+    static Scene scene = {0};
+    game_sim_init(&scene.state, 1);
+
+    test_sword_kill_prevents_touch(&scene);
+    test_one_sword_hit_per_swing(&scene);
+    test_touch_does_not_stop_later_sword(&scene);
+    test_one_contact_hit_per_tick(&scene);
+
+    game_sim_cleanup(&scene.state);
+    texture_cache_shutdown();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
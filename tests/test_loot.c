@@ -341,6 +341,8 @@ void test_loot_list_creation()
                           "List created with 0 items");
     test_assert_equal_int("loot_list_creation", list.capacity, 10,
                           "List created with capacity 10");
+
+    loot_list_cleanup(&list);
 }
 
 void test_loot_list_add()
@@ -533,6 +535,31 @@ void test_invalid_loot_type_handling()
                           "Invalid type query returns 0");
 }
 
+void test_sleeping_loot_stays_frozen()
+{
+    printf("\n--- Test Suite 21: Loot In Sleeping Sectors (Sector Window) ---\n");
+
+    LootList list = loot_list_create(2);
+    BodyBatch bodies = body_batch_create(2);
+    SectorWindow awake = sector_window(0.0f, 0); // Only sector 0 simulates
+
+    Vector2 near = {100.0f, 50.0f};
+    Vector2 far = {5.0f * SIM_SECTOR_WIDTH, 50.0f};
+    loot_list_add(&list, loot_create(LOOT_COIN, near, 1, NULL));
+    loot_list_add(&list, loot_create(LOOT_COIN, far, 1, NULL));
+    float far_lifetime = list.loot[1].lifetime;
+
+    int frozen = loot_list_update(&list, &bodies, &awake, 0.0f, SIMULATION_DT);
+
+    test_assert_equal_int("sleeping_loot", frozen, 1, "One item frozen");
+    test_assert("sleeping_loot", list.loot[0].position.y < near.y, "The awake item pops up");
+    test_assert_equal_float("sleeping_loot", list.loot[1].position.y, far.y, 0.0f, "The sleeping item stays put");
+    test_assert_equal_float("sleeping_loot", list.loot[1].lifetime, far_lifetime, 0.0f, "The sleeping item does not age");
+
+    body_batch_cleanup(&bodies);
+    loot_list_cleanup(&list);
+}
+
 // ============ MAIN TEST RUNNER ============
 
 int main(int argc, char *argv[])
@@ -563,6 +590,7 @@ int main(int argc, char *argv[])
     test_large_loot_list();
     test_inventory_mixed_types();
     test_invalid_loot_type_handling();
+    test_sleeping_loot_stays_frozen();
 
     // Print summary
     print_test_summary();
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+
+// Include headers for testing
+#include "../include/periodic.h"
+#include "../include/config.h"
+
+// Patrol paths must follow their first leg and then bounce between the bounds at their speed,
+// stay precise far from the origin and late in a session, and fade cycles must go through
+// their phases at the right times, as pure functions of time.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_near(const char *test_name, float expected, float actual, float tolerance, const char *message)
+{
+    test_assert(test_name, fabsf(expected - actual) <= tolerance, message);
+    if (fabsf(expected - actual) > tolerance)
+    {
+        printf("  Expected: %f, Actual: %f\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ TESTS ============
+
+static void test_first_leg_then_bounce(void)
+{
+    // Starts at 150 moving right at 50 until it reaches 300 (3 s), then 200 a second between the bounds
+    PatrolPath path = {150.0f, 50.0f, 100.0f, 300.0f, 200.0f};
+    float velocity;
+
+    test_assert_near("patrol", 150.0f, patrol_path_x(&path, 0.0, &velocity), 1e-4f, "Time 0 is the origin");
+    test_assert_near("patrol", 50.0f, velocity, 0.0f, "The first leg runs at the origin velocity");
+    test_assert_near("patrol", 250.0f, patrol_path_x(&path, 2.0, NULL), 1e-4f, "The first leg moves at its own velocity");
+    test_assert_near("patrol", 200.0f, patrol_path_x(&path, 3.5, &velocity), 1e-4f, "After the bound it heads back at the patrol speed");
+    test_assert_near("patrol", -200.0f, velocity, 0.0f, "Heading back left");
+    test_assert_near("patrol", 100.0f, patrol_path_x(&path, 4.0, NULL), 1e-4f, "It reaches the left bound a span later");
+    test_assert_near("patrol", 150.0f, patrol_path_x(&path, 4.25, &velocity), 1e-4f, "It bounces off the left bound");
+    test_assert_near("patrol", 200.0f, velocity, 0.0f, "Heading right again");
+}
+
+static void test_stays_between_bounds(void)
+{
+    PatrolPath path = {400.0f, -120.0f, 250.0f, 900.0f, 170.0f};
+
+    bool inside = true;
+    bool continuous = true;
+    float previous = patrol_path_x(&path, 0.0, NULL);
+    for (int tick = 1; tick < 120 * 60; tick++)
+    {
+        float x = patrol_path_x(&path, tick * (double)SIMULATION_DT, NULL);
+        inside = inside && x >= 250.0f - 1e-3f && x <= 900.0f + 1e-3f;
+        continuous = continuous && fabsf(x - previous) <= 170.0f * SIMULATION_DT + 1e-3f;
+        previous = x;
+    }
+    test_assert("bounds", inside, "A minute of ticks never leaves the bounds");
+    test_assert("bounds", continuous, "No tick moves further than the patrol speed allows");
+}
+
+static void test_edge_cases(void)
+{
+    PatrolPath still = {500.0f, 0.0f, 0.0f, 1000.0f, 100.0f};
+    float velocity = 1.0f;
+    test_assert_near("edges", 500.0f, patrol_path_x(&still, 30.0, &velocity), 0.0f, "No origin velocity stays at the origin");
+    test_assert_near("edges", 0.0f, velocity, 0.0f, "A path that stays put has no velocity");
+
+    PatrolPath pinned = {1900.0f, 50.0f, 1300.0f, 1300.0f, 70.0f};
+    test_assert_near("edges", 1300.0f, patrol_path_x(&pinned, 0.5, NULL), 0.0f, "Equal bounds pin the path to them");
+
+    PatrolPath outside = {50.0f, 80.0f, 100.0f, 300.0f, 80.0f};
+    test_assert_near("edges", 140.0f, patrol_path_x(&outside, 0.5, NULL), 1e-4f, "An origin left of the bounds starts from the left bound");
+}
+
+static void test_far_bound_keeps_precision(void)
+{
+    // One bound so far away it is never reached: the path just keeps going left
+    PatrolPath path = {2000.0f, 50.0f, -100000000000000000.0f, 2000.0f, 500.0f};
+    test_assert_near("precision", 2000.0f - 500.0f * 10.0f, patrol_path_x(&path, 10.0, NULL), 1e-3f,
+                     "Positions near the origin stay exact next to a huge bound");
+}
+
+static void test_late_in_a_session(void)
+{
+    // A 6 second round trip, so ten hours in it is where it was at the start
+    PatrolPath path = {100.0f, 100.0f, 100.0f, 400.0f, 100.0f};
+    double late = 10.0 * 60.0 * 60.0;
+    test_assert_near("late", patrol_path_x(&path, 1.25, NULL), patrol_path_x(&path, late + 1.25, NULL), 1e-3f,
+                     "Ten hours in the path repeats to well under a pixel");
+}
+
+static void test_fade_phases(void)
+{
+    FadeCycle cycle = {1.0f, 2.0f, 1.0f, 4.0f}; // 8 second cycle
+    bool faded_out;
+
+    test_assert_near("fade", 1.0f, fade_cycle_opacity(&cycle, 0.5, &faded_out), 0.0f, "Opaque at first");
+    test_assert("fade", !faded_out, "Opaque is dangerous");
+    test_assert_near("fade", 0.5f, fade_cycle_opacity(&cycle, 2.0, &faded_out), 1e-5f, "Halfway through the fade out");
+    test_assert("fade", faded_out, "Fading out is already safe");
+    test_assert_near("fade", 0.0f, fade_cycle_opacity(&cycle, 3.5, &faded_out), 0.0f, "Invisible while faded out");
+    test_assert("fade", faded_out, "Faded out is safe");
+    test_assert_near("fade", 0.25f, fade_cycle_opacity(&cycle, 5.0, &faded_out), 1e-5f, "A quarter through the fade in");
+    test_assert("fade", !faded_out, "Fading in is dangerous again");
+    test_assert_near("fade", 0.5f, fade_cycle_opacity(&cycle, 8.0 * 100 + 2.0, &faded_out), 1e-4f, "The cycle repeats");
+}
+
+static void test_instant_fades(void)
+{
+    FadeCycle cycle = {1.0f, 0.0f, 3.0f, 0.0f};
+    bool faded_out;
+
+    test_assert_near("instant", 1.0f, fade_cycle_opacity(&cycle, 0.99, &faded_out), 0.0f, "Opaque up to the fade");
+    test_assert_near("instant", 0.0f, fade_cycle_opacity(&cycle, 1.0, &faded_out), 0.0f, "A 0 second fade out is instant");
+    test_assert("instant", faded_out, "And safe at once");
+    test_assert_near("instant", 1.0f, fade_cycle_opacity(&cycle, 4.0, &faded_out), 0.0f, "A 0 second fade in is instant");
+    test_assert("instant", !faded_out, "And dangerous at once");
+
+    FadeCycle never = {0.0f, 0.0f, 0.0f, 0.0f};
+    test_assert_near("instant", 1.0f, fade_cycle_opacity(&never, 12.0, &faded_out), 0.0f, "An empty cycle stays opaque");
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║     PERIODIC MOTION TEST SUITE         ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_first_leg_then_bounce();
+    test_stays_between_bounds();
+    test_edge_cases();
+    test_far_bound_keeps_precision();
+    test_late_in_a_session();
+    test_fade_phases();
+    test_instant_fades();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include headers for testing
+#include "../include/replay.h"
+
+#define TEST_REPLAY_PATH "test_replay.ktvr"
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_equal_int(const char *test_name, int expected, int actual, const char *message)
+{
+    test_assert(test_name, expected == actual, message);
+    if (expected != actual)
+    {
+        printf("  Expected: %d, Actual: %d\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ TESTS ============
+
+void test_round_trip()
+{
+    printf("\n--- Test Suite 1: Round Trip ---\n");
+
+    // 100 ticks walking right, a jump, a paused stretch and two shots at different targets
+    ReplayTick ticks[140];
+    memset(ticks, 0, sizeof(ticks));
+    for (int i = 0; i < 140; i++)
+    {
+        ticks[i].input.move_right = i < 100;
+    }
+    ticks[50].input.jump = true;
+    for (int i = 100; i < 130; i++)
+    {
+        ticks[i].pause_menu_active = true;
+    }
+    ticks[135].input.fire = true;
+    ticks[135].input.fire_target = (Vector2){1234.5f, 321.25f};
+    ticks[136].input.fire = true;
+    ticks[136].input.fire_target = (Vector2){-10.0f, 80.0f};
+
+    ReplayRecorder recorder;
+    test_assert("round_trip", replay_recorder_open(&recorder, TEST_REPLAY_PATH, 4242, 7), "Recorder opens");
+    for (int i = 0; i < 140; i++)
+    {
+        replay_recorder_write(&recorder, &ticks[i]);
+    }
+    replay_recorder_close(&recorder);
+
+    ReplayPlayer player;
+    test_assert("round_trip", replay_player_open(&player, TEST_REPLAY_PATH), "Player opens");
+    test_assert_equal_int("round_trip", 4242, (int)player.seed, "Seed is preserved");
+    test_assert_equal_int("round_trip", 7, player.start_level, "Start level is preserved");
+
+    int mismatches = 0;
+    ReplayTick tick;
+    for (int i = 0; i < 140; i++)
+    {
+        if (!replay_player_next(&player, &tick) ||
+            memcmp(&tick.input, &ticks[i].input, sizeof(PlayerInput)) != 0 ||
+            tick.pause_menu_active != ticks[i].pause_menu_active)
+        {
+            mismatches++;
+        }
+    }
+    test_assert_equal_int("round_trip", 0, mismatches, "Every tick plays back exactly");
+    test_assert("round_trip", !replay_player_next(&player, &tick), "Stream ends after the last tick");
+    replay_player_close(&player);
+
+    // Runs collapse: header (14 bytes) plus 8 runs, two of which carry a fire target
+    FILE *file = fopen(TEST_REPLAY_PATH, "rb");
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    test_assert("round_trip", size < 64, "140 ticks encode into a few dozen bytes");
+
+    remove(TEST_REPLAY_PATH);
+}
+
+void test_rejects_bad_files()
+{
+    printf("\n--- Test Suite 2: Invalid Files ---\n");
+
+    ReplayPlayer player;
+    test_assert("invalid", !replay_player_open(&player, "missing_replay.ktvr"), "Missing file is rejected");
+
+    FILE *file = fopen(TEST_REPLAY_PATH, "wb");
+    fputs("NOPE not a replay", file);
+    fclose(file);
+    test_assert("invalid", !replay_player_open(&player, TEST_REPLAY_PATH), "Wrong magic is rejected");
+    remove(TEST_REPLAY_PATH);
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║          REPLAY TEST SUITE             ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_round_trip();
+    test_rejects_bad_files();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
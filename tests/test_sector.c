@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+
+// Include headers for testing
+#include "../include/sector.h"
+#include "../include/config.h"
+
+// Positions must land in the right sector (including negative x and sector edges), the
+// window must cover the radius around the camera's sector and nothing more, and the skipped
+// counts must add up.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_near(const char *test_name, float expected, float actual, float tolerance, const char *message)
+{
+    test_assert(test_name, fabsf(expected - actual) <= tolerance, message);
+    if (fabsf(expected - actual) > tolerance)
+    {
+        printf("  Expected: %f, Actual: %f\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ TESTS ============
+
+static void test_sector_of(void)
+{
+    test_assert("sector_of", sector_of(0.0f) == 0, "x = 0 starts sector 0");
+    test_assert("sector_of", sector_of(SIM_SECTOR_WIDTH - 0.5f) == 0, "Just left of the edge is still sector 0");
+    test_assert("sector_of", sector_of(SIM_SECTOR_WIDTH) == 1, "The edge starts the next sector");
+    test_assert("sector_of", sector_of(-0.5f) == -1, "Just left of 0 is sector -1");
+    test_assert("sector_of", sector_of(6000.0f) == (int)(6000.0f / SIM_SECTOR_WIDTH), "The far end of a long level");
+}
+
+static void test_window(void)
+{
+    float camera_x = 5.5f * SIM_SECTOR_WIDTH;
+    SectorWindow window = sector_window(camera_x, 2);
+
+    test_assert("window", window.first == 3 && window.last == 7, "Two sectors either side of sector 5");
+    test_assert("window", sector_window_count(&window) == 5, "Five sectors awake");
+    test_assert_near("window", 3.0f * SIM_SECTOR_WIDTH, window.min_x, 0.0f, "Starts at the left edge of the first sector");
+    test_assert_near("window", 8.0f * SIM_SECTOR_WIDTH, window.max_x, 0.0f, "Ends at the right edge of the last sector");
+
+    test_assert("window", sector_window_contains(&window, camera_x), "The camera is awake");
+    test_assert("window", sector_window_contains(&window, window.min_x), "The left edge is awake");
+    test_assert("window", !sector_window_contains(&window, window.max_x), "The right edge belongs to a sleeping sector");
+    test_assert("window", !sector_window_contains(&window, window.min_x - 1.0f), "Left of the window sleeps");
+
+    SectorWindow alone = sector_window(camera_x, 0);
+    test_assert("window", sector_window_count(&alone) == 1, "Radius 0 keeps only the camera's sector");
+}
+
+static void test_overlaps(void)
+{
+    SectorWindow window = sector_window(0.0f, 1); // Sectors -1 to 1
+
+    test_assert("overlaps", sector_window_overlaps(&window, -5000.0f, -SIM_SECTOR_WIDTH), "A span ending on the left edge touches it");
+    test_assert("overlaps", !sector_window_overlaps(&window, -5000.0f, -SIM_SECTOR_WIDTH - 1.0f), "A span ending before it does not");
+    test_assert("overlaps", sector_window_overlaps(&window, -5000.0f, 5000.0f), "A span across the whole window overlaps");
+    test_assert("overlaps", !sector_window_overlaps(&window, 2.0f * SIM_SECTOR_WIDTH, 3.0f * SIM_SECTOR_WIDTH), "A span in a sleeping sector does not");
+}
+
+static void test_radius_covers_think_bands(void)
+{
+    // Monsters think up to AI_MID_DISTANCE away; wherever the camera is in its sector, that
+    // distance stays awake
+    SectorWindow left_edge = sector_window(0.0f, SIM_SECTOR_RADIUS);
+    SectorWindow right_edge = sector_window(SIM_SECTOR_WIDTH - 0.5f, SIM_SECTOR_RADIUS);
+    test_assert("radius", sector_window_contains(&left_edge, AI_MID_DISTANCE), "Mid band awake to the right");
+    test_assert("radius", sector_window_contains(&right_edge, SIM_SECTOR_WIDTH - 0.5f - AI_MID_DISTANCE), "Mid band awake to the left");
+}
+
+static void test_stats_skipped(void)
+{
+    SectorStats stats = {7, 1, 2, 3, 4, 5};
+    test_assert("stats", sector_stats_skipped(&stats) == 15, "Skipped counts add up");
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║     SECTOR WINDOW TEST SUITE           ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_sector_of();
+    test_window();
+    test_overlaps();
+    test_radius_covers_think_bands();
+    test_stats_skipped();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
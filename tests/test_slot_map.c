@@ -0,0 +1,180 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include headers for testing
+#include "../include/slot_map.h"
+
+// Handles must keep finding their item while others are added and removed around it, and
+// must stop finding it once it is gone, even after its slot has been reused.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_equal_int(const char *test_name, int expected, int actual, const char *message)
+{
+    test_assert(test_name, expected == actual, message);
+    if (expected != actual)
+    {
+        printf("  Expected: %d, Actual: %d\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ HELPERS ============
+
+typedef struct
+{
+    int id;
+} Item;
+
+typedef struct
+{
+    SLOT_MAP_FIELDS(Item, items)
+} ItemMap;
+
+SLOT_MAP_DECLARE(ItemMap, Item, item_map)
+
+static int released = 0;
+
+static void count_release(Item *item)
+{
+    released++;
+}
+
+SLOT_MAP_DEFINE(ItemMap, Item, items, item_map, SLOT_MAP_NO_HOOK, count_release)
+
+// ============ TESTS ============
+
+void test_handles_follow_items()
+{
+    printf("\n=== Testing Handles Follow Items ===\n");
+
+    ItemMap map = item_map_create(2);
+    SlotHandle handles[20];
+    for (int i = 0; i < 20; i++)
+    {
+        handles[i] = item_map_add(&map, (Item){i});
+    }
+    test_assert_equal_int("grow", 20, map.count, "Adding past the capacity grows the map");
+
+    // Remove every third item; the last item moves into each hole
+    for (int i = 0; i < 20; i += 3)
+    {
+        test_assert("remove", item_map_remove(&map, handles[i]), "Live handle removes its item");
+    }
+    test_assert_equal_int("remove", 13, map.count, "Removed items leave the packed array");
+
+    int all_found = 1;
+    for (int i = 0; i < 20; i++)
+    {
+        Item *item = item_map_get(&map, handles[i]);
+        if (i % 3 == 0)
+            all_found = all_found && item == NULL;
+        else
+            all_found = all_found && item != NULL && item->id == i;
+    }
+    test_assert("get", all_found, "Survivors are found through their handles, removed items are not");
+
+    int positions_match = 1;
+    for (int i = 0; i < map.count; i++)
+    {
+        SlotHandle handle = item_map_handle(&map, i);
+        positions_match = positions_match && item_map_get(&map, handle) == &map.items[i];
+    }
+    test_assert("handle", positions_match, "Handle of a position leads back to it");
+
+    item_map_cleanup(&map);
+}
+
+void test_stale_handles()
+{
+    printf("\n=== Testing Stale Handles ===\n");
+
+    ItemMap map = item_map_create(4);
+    SlotHandle old = item_map_add(&map, (Item){1});
+    item_map_remove(&map, old);
+    SlotHandle reused = item_map_add(&map, (Item){2});
+
+    test_assert_equal_int("reuse", old.slot, reused.slot, "Freed slot is reused");
+    test_assert("stale", item_map_get(&map, old) == NULL, "Old handle misses the slot's new item");
+    test_assert("stale", !item_map_remove(&map, old), "Old handle removes nothing");
+    test_assert_equal_int("stale", 1, map.count, "New item is still there");
+    test_assert("none", item_map_get(&map, SLOT_HANDLE_NONE) == NULL, "SLOT_HANDLE_NONE finds nothing");
+
+    item_map_cleanup(&map);
+}
+
+void test_release_hook()
+{
+    printf("\n=== Testing Release Hook ===\n");
+
+    released = 0;
+    ItemMap map = item_map_create(4);
+    SlotHandle first = item_map_add(&map, (Item){1});
+    for (int i = 0; i < 5; i++)
+    {
+        item_map_add(&map, (Item){i});
+    }
+    item_map_remove(&map, first);
+    test_assert_equal_int("release", 1, released, "Removing releases the item");
+
+    item_map_clear(&map);
+    test_assert_equal_int("release", 6, released, "Clearing releases every item");
+    test_assert("clear", item_map_get(&map, first) == NULL && map.count == 0, "Clearing empties the map");
+
+    item_map_add(&map, (Item){7});
+    item_map_cleanup(&map);
+    test_assert_equal_int("release", 7, released, "Cleanup releases what is left");
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║        SLOT MAP TEST SUITE             ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_handles_follow_items();
+    test_stale_handles();
+    test_release_hook();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
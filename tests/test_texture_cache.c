@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include headers for testing
+#include "../include/texture_cache.h"
+
+// The assets used below intentionally do not exist: LoadTexture then fails without
+// touching the GPU, which lets the registry bookkeeping be tested without a window.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_equal_int(const char *test_name, int expected, int actual, const char *message)
+{
+    test_assert(test_name, expected == actual, message);
+    if (expected != actual)
+    {
+        printf("  Expected: %d, Actual: %d\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ TESTS ============
+
+void test_acquire_same_asset_shares_handle()
+{
+    printf("\n--- Test Suite 1: Shared Handles ---\n");
+
+    TextureHandle a = texture_cache_acquire("missing_bat.png");
+    TextureHandle b = texture_cache_acquire("missing_bat.png");
+
+    test_assert("shared_handle", a != TEXTURE_HANDLE_INVALID, "First acquire returns a valid handle");
+    test_assert_equal_int("shared_handle", a, b, "Second acquire returns the same handle");
+    test_assert_equal_int("shared_handle", 2, texture_cache_ref_count(a), "Reference count is 2");
+    test_assert_equal_int("shared_handle", 1, texture_cache_loaded_count(), "Only one entry is resident");
+
+    texture_cache_release(a);
+    texture_cache_release(b);
+}
+
+void test_path_normalization()
+{
+    printf("\n--- Test Suite 2: Path Normalization ---\n");
+
+    TextureHandle bare = texture_cache_acquire("missing_slug.png");
+    TextureHandle relative = texture_cache_acquire("../assets/missing_slug.png");
+
+    test_assert_equal_int("path_normalization", bare, relative,
+                          "Relative asset path resolves to the bare filename entry");
+
+    texture_cache_release(bare);
+    texture_cache_release(relative);
+}
+
+void test_release_unloads_at_zero()
+{
+    printf("\n--- Test Suite 3: Reference Counting ---\n");
+
+    TextureHandle h = texture_cache_acquire("missing_crab.png");
+    texture_cache_acquire("missing_crab.png");
+
+    texture_cache_release(h);
+    test_assert_equal_int("release", 1, texture_cache_ref_count(h), "One reference left after first release");
+    test_assert_equal_int("release", 1, texture_cache_loaded_count(), "Entry still resident");
+
+    texture_cache_release(h);
+    test_assert_equal_int("release", 0, texture_cache_ref_count(h), "No references after last release");
+    test_assert_equal_int("release", 0, texture_cache_loaded_count(), "Entry freed after last release");
+
+    // Releasing a dead handle is harmless
+    texture_cache_release(h);
+    test_assert_equal_int("release", 0, texture_cache_loaded_count(), "Extra release is ignored");
+}
+
+void test_stale_handle_after_reuse()
+{
+    printf("\n--- Test Suite 4: Stale Handles ---\n");
+
+    TextureHandle old = texture_cache_acquire("missing_crab.png");
+    texture_cache_release(old);
+
+    // The freed slot is the first free one, so the next asset lands in it
+    TextureHandle reused = texture_cache_acquire("missing_eel.png");
+    test_assert("stale", reused != old, "A reused slot gets a new handle");
+    test_assert_equal_int("stale", 0, texture_cache_ref_count(old), "The old handle no longer counts references");
+
+    texture_cache_release(old); // Must not drop the new texture's reference
+    test_assert_equal_int("stale", 1, texture_cache_ref_count(reused), "Releasing the old handle leaves the new entry alone");
+
+    texture_cache_release(reused);
+}
+
+void test_invalid_handles()
+{
+    printf("\n--- Test Suite 5: Invalid Handles ---\n");
+
+    test_assert_equal_int("invalid", TEXTURE_HANDLE_INVALID, texture_cache_acquire(NULL), "NULL name is rejected");
+    test_assert_equal_int("invalid", TEXTURE_HANDLE_INVALID, texture_cache_acquire(""), "Empty name is rejected");
+    test_assert_equal_int("invalid", 0, (int)texture_cache_get_sprite(TEXTURE_HANDLE_INVALID).texture.id, "Invalid handle yields empty texture");
+    test_assert_equal_int("invalid", 0, (int)texture_cache_get_sprite(9999).texture.id, "Out of range handle yields empty texture");
+    texture_cache_release(-3); // Must not crash
+}
+
+void test_shutdown_clears_registry()
+{
+    printf("\n--- Test Suite 6: Shutdown ---\n");
+
+    texture_cache_acquire("missing_a.png");
+    texture_cache_acquire("missing_b.png");
+    test_assert_equal_int("shutdown", 2, texture_cache_loaded_count(), "Two entries resident");
+
+    TextureHandle before = texture_cache_acquire("missing_a.png");
+    texture_cache_shutdown();
+    test_assert_equal_int("shutdown", 0, texture_cache_loaded_count(), "Registry empty after shutdown");
+
+    TextureHandle after = texture_cache_acquire("missing_c.png");
+    test_assert("shutdown", before != after, "Handles from before the shutdown stay stale");
+    texture_cache_release(after);
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║       TEXTURE CACHE TEST SUITE         ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_acquire_same_asset_shares_handle();
+    test_path_normalization();
+    test_release_unloads_at_zero();
+    test_stale_handle_after_reuse();
+    test_invalid_handles();
+    test_shutdown_clears_registry();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
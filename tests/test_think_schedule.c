@@ -0,0 +1,200 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+
+// Include headers for testing
+#include "../include/think_schedule.h"
+#include "../include/config.h"
+
+// Agents near the camera must think every tick, mid-range agents once per interval on ticks
+// spread across the interval, and far agents never; no thinking agent may lose time.
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_equal_int(const char *test_name, int expected, int actual, const char *message)
+{
+    test_assert(test_name, expected == actual, message);
+    if (expected != actual)
+    {
+        printf("  Expected: %d, Actual: %d\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ TESTS ============
+
+static void test_bands(void)
+{
+    test_assert("bands", think_band(0.0f) == THINK_BAND_NEAR, "The camera's own position is near");
+    test_assert("bands", think_band(AI_NEAR_DISTANCE - 1.0f) == THINK_BAND_NEAR, "Just inside the near distance is near");
+    test_assert("bands", think_band(AI_NEAR_DISTANCE) == THINK_BAND_MID, "The near distance starts the mid band");
+    test_assert("bands", think_band(AI_MID_DISTANCE) == THINK_BAND_DORMANT, "The mid distance starts the dormant band");
+}
+
+static void test_near_thinks_every_tick(void)
+{
+    float x[3] = {0.0f, -500.0f, 900.0f};
+    float owed[3] = {0};
+    float think_dt[3];
+
+    bool every_tick = true;
+    for (unsigned int tick = 0; tick < 30; tick++)
+    {
+        int thinking = think_schedule(x, 3, 0.0f, tick, SIMULATION_DT, owed, think_dt);
+        every_tick = every_tick && thinking == 3;
+        for (int i = 0; i < 3; i++)
+        {
+            every_tick = every_tick && think_dt[i] == SIMULATION_DT;
+        }
+    }
+    test_assert("near", every_tick, "Near agents think every tick with the tick's length");
+}
+
+static void test_mid_band_is_spread(void)
+{
+    // As many mid-band agents as ticks in an interval: one of them thinks per tick
+    enum { COUNT = THINK_MID_INTERVAL };
+    float x[COUNT];
+    float owed[COUNT] = {0};
+    float think_dt[COUNT];
+    int thinks[COUNT] = {0};
+    for (int i = 0; i < COUNT; i++)
+    {
+        x[i] = AI_NEAR_DISTANCE + 10.0f * i;
+    }
+
+    int most_per_tick = 0;
+    for (unsigned int tick = 0; tick < 10 * THINK_MID_INTERVAL; tick++)
+    {
+        int thinking = think_schedule(x, COUNT, 0.0f, tick, SIMULATION_DT, owed, think_dt);
+        most_per_tick = thinking > most_per_tick ? thinking : most_per_tick;
+        for (int i = 0; i < COUNT; i++)
+        {
+            thinks[i] += think_dt[i] > 0.0f;
+        }
+    }
+
+    test_assert_equal_int("mid", 1, most_per_tick, "Mid-band thinks land on different ticks");
+    bool rate = true;
+    for (int i = 0; i < COUNT; i++)
+    {
+        rate = rate && thinks[i] == 10;
+    }
+    test_assert("mid", rate, "Each mid-band agent thinks once per interval");
+}
+
+static void test_time_is_not_lost(void)
+{
+    // An agent drifting from the mid band into the near band gets every tick's time
+    float x[1] = {AI_NEAR_DISTANCE + 5.0f};
+    float owed[1] = {0};
+    float think_dt[1];
+    float stepped = 0.0f;
+    float elapsed = 0.0f;
+
+    for (unsigned int tick = 0; tick < 5 * THINK_MID_INTERVAL + 3; tick++)
+    {
+        if (tick == 5 * THINK_MID_INTERVAL - 4)
+            x[0] = 100.0f; // Now near, with some time owed
+        think_schedule(x, 1, 0.0f, tick, SIMULATION_DT, owed, think_dt);
+        stepped += think_dt[0];
+        elapsed += SIMULATION_DT;
+    }
+
+    test_assert("time", fabsf(stepped - elapsed) < 1e-4f, "Thinking steps add up to the elapsed time");
+    test_assert("time", owed[0] == 0.0f, "Nothing is owed once the agent is near");
+}
+
+static void test_dormant_is_frozen(void)
+{
+    float x[2] = {AI_MID_DISTANCE + 1.0f, -AI_MID_DISTANCE - 500.0f};
+    float owed[2] = {0.5f, 0.0f};
+    float think_dt[2];
+
+    int thinking = 0;
+    for (unsigned int tick = 0; tick < 3 * THINK_MID_INTERVAL; tick++)
+    {
+        thinking += think_schedule(x, 2, 0.0f, tick, SIMULATION_DT, owed, think_dt);
+    }
+    test_assert_equal_int("dormant", 0, thinking, "Dormant agents never think");
+    test_assert("dormant", owed[0] == 0.0f && owed[1] == 0.0f, "Dormant agents owe no time");
+}
+
+static void test_deterministic(void)
+{
+    enum { COUNT = 200 };
+    float x[COUNT];
+    float owed_a[COUNT] = {0}, owed_b[COUNT] = {0};
+    float dt_a[COUNT], dt_b[COUNT];
+    for (int i = 0; i < COUNT; i++)
+    {
+        x[i] = (float)(rand() % 8000) - 2000.0f;
+    }
+
+    bool same = true;
+    for (unsigned int tick = 0; tick < 100; tick++)
+    {
+        float camera_x = tick * 15.0f;
+        think_schedule(x, COUNT, camera_x, tick, SIMULATION_DT, owed_a, dt_a);
+        think_schedule(x, COUNT, camera_x, tick, SIMULATION_DT, owed_b, dt_b);
+        same = same && memcmp(dt_a, dt_b, sizeof(dt_a)) == 0 && memcmp(owed_a, owed_b, sizeof(owed_a)) == 0;
+    }
+    test_assert("determinism", same, "The same ticks and positions give the same schedule");
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║      THINK SCHEDULE TEST SUITE         ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_bands();
+    test_near_thinks_every_tick();
+    test_mid_band_is_spread();
+    test_time_is_not_lost();
+    test_dormant_is_frozen();
+    test_deterministic();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,279 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Include headers for testing
+#include "../include/timer_wheel.h"
+#include "../include/config.h"
+
+// Every timer must fire on exactly the tick it was scheduled for, however far out, in the
+// order timers were scheduled; cancelled and fired timers must never fire (again).
+
+// ============ TEST UTILITIES ============
+
+typedef struct
+{
+    int passed;
+    int failed;
+    int total;
+} TestStats;
+
+static TestStats test_stats = {0, 0, 0};
+
+void test_assert(const char *test_name, int condition, const char *message)
+{
+    test_stats.total++;
+    if (condition)
+    {
+        test_stats.passed++;
+        printf("✓ PASS: %s - %s\n", test_name, message);
+    }
+    else
+    {
+        test_stats.failed++;
+        printf("✗ FAIL: %s - %s\n", test_name, message);
+    }
+}
+
+void test_assert_equal_int(const char *test_name, int expected, int actual, const char *message)
+{
+    test_assert(test_name, expected == actual, message);
+    if (expected != actual)
+    {
+        printf("  Expected: %d, Actual: %d\n", expected, actual);
+    }
+}
+
+void print_test_summary()
+{
+    printf("\n");
+    printf("========================================\n");
+    printf("TEST SUMMARY\n");
+    printf("========================================\n");
+    printf("Total: %d\n", test_stats.total);
+    printf("Passed: %d\n", test_stats.passed);
+    printf("Failed: %d\n", test_stats.failed);
+    printf("========================================\n");
+}
+
+// ============ HELPERS ============
+
+#define MAX_FIRES 4096
+
+typedef struct
+{
+    int id[MAX_FIRES];
+    unsigned int tick[MAX_FIRES];
+    int count;
+    const TimerWheel *wheel;
+} FireLog;
+
+static void record_fire(void *context, int arg)
+{
+    FireLog *log = (FireLog *)context;
+    if (log->count < MAX_FIRES)
+    {
+        log->id[log->count] = arg;
+        log->tick[log->count] = log->wheel->now;
+        log->count++;
+    }
+}
+
+// ============ TESTS ============
+
+static void test_fires_on_time(void)
+{
+    // Delays across every level of the wheel, including the slot boundaries
+    static const unsigned int delays[] = {1, 2, 63, 64, 65, 100, 127, 128, 4095, 4096, 4097,
+                                          5000, 70000, 262143, 262144, 300000};
+    enum { COUNT = sizeof(delays) / sizeof(delays[0]) };
+
+    TimerWheel wheel = timer_wheel_create(4);
+    static FireLog log;
+    log.count = 0;
+    log.wheel = &wheel;
+
+    // Start off a block boundary so the cascades are exercised from an odd offset
+    for (int i = 0; i < 37; i++)
+        timer_wheel_advance(&wheel);
+
+    unsigned int start = wheel.now;
+    for (int i = 0; i < COUNT; i++)
+    {
+        timer_wheel_schedule(&wheel, delays[i], record_fire, &log, i);
+    }
+    test_assert_equal_int("on time", COUNT, wheel.pending, "Every timer is pending");
+
+    while (wheel.now < start + 300000)
+        timer_wheel_advance(&wheel);
+
+    test_assert_equal_int("on time", COUNT, log.count, "Every timer fired once");
+    bool on_time = true;
+    for (int f = 0; f < log.count; f++)
+    {
+        on_time = on_time && log.tick[f] == start + delays[log.id[f]];
+    }
+    test_assert("on time", on_time, "Each timer fired on the tick it was due");
+    test_assert_equal_int("on time", 0, wheel.pending, "Nothing is left pending");
+
+    timer_wheel_cleanup(&wheel);
+}
+
+static void test_same_tick_order(void)
+{
+    TimerWheel wheel = timer_wheel_create(0);
+    static FireLog log;
+    log.count = 0;
+    log.wheel = &wheel;
+
+    // Due on the same tick: two scheduled together, one from further out (an outer level)
+    timer_wheel_schedule(&wheel, 200, record_fire, &log, 0);
+    for (int i = 0; i < 150; i++)
+        timer_wheel_advance(&wheel);
+    timer_wheel_schedule(&wheel, 50, record_fire, &log, 1);
+    timer_wheel_schedule(&wheel, 50, record_fire, &log, 2);
+    for (int i = 0; i < 50; i++)
+        timer_wheel_advance(&wheel);
+
+    test_assert_equal_int("order", 3, log.count, "Timers due together all fire");
+    int first = -1, second = -1;
+    for (int f = 0; f < log.count; f++)
+    {
+        first = log.id[f] == 1 ? f : first;
+        second = log.id[f] == 2 ? f : second;
+    }
+    test_assert("order", first >= 0 && first < second, "Timers scheduled together fire in schedule order");
+
+    // The same calls on a fresh wheel fire in the same order
+    int expected[3] = {log.id[0], log.id[1], log.id[2]};
+    TimerWheel again = timer_wheel_create(0);
+    log.count = 0;
+    log.wheel = &again;
+    timer_wheel_schedule(&again, 200, record_fire, &log, 0);
+    for (int i = 0; i < 150; i++)
+        timer_wheel_advance(&again);
+    timer_wheel_schedule(&again, 50, record_fire, &log, 1);
+    timer_wheel_schedule(&again, 50, record_fire, &log, 2);
+    for (int i = 0; i < 50; i++)
+        timer_wheel_advance(&again);
+    test_assert("order", log.count == 3 && memcmp(expected, log.id, sizeof(expected)) == 0,
+                "Repeating the calls repeats the firing order");
+
+    timer_wheel_cleanup(&wheel);
+    timer_wheel_cleanup(&again);
+}
+
+static void test_cancel_and_handles(void)
+{
+    TimerWheel wheel = timer_wheel_create(2);
+    static FireLog log;
+    log.count = 0;
+    log.wheel = &wheel;
+
+    TimerHandle kept = timer_wheel_schedule(&wheel, 10, record_fire, &log, 1);
+    TimerHandle cancelled = timer_wheel_schedule(&wheel, 10, record_fire, &log, 2);
+    TimerHandle far = timer_wheel_schedule(&wheel, 10000, record_fire, &log, 3);
+
+    test_assert("cancel", timer_wheel_cancel(&wheel, cancelled), "A pending timer can be cancelled");
+    test_assert("cancel", !timer_wheel_cancel(&wheel, cancelled), "A cancelled timer cannot be cancelled again");
+    test_assert("cancel", timer_wheel_cancel(&wheel, far), "A timer on an outer level can be cancelled");
+
+    // The cancelled node is reused; its old handle must not see the new timer
+    TimerHandle reused = timer_wheel_schedule(&wheel, 5, NULL, NULL, 0);
+    test_assert("handles", reused.node == far.node || reused.node == cancelled.node, "Freed nodes are reused");
+    test_assert("handles", !timer_wheel_pending(&wheel, cancelled) && !timer_wheel_pending(&wheel, far),
+                "Old handles do not match a reused node");
+    test_assert("handles", timer_wheel_remaining(&wheel, reused) == 5.0f / SIMULATION_TICK_RATE,
+                "Remaining time counts down from the scheduled ticks");
+
+    for (int i = 0; i < 20000; i++)
+        timer_wheel_advance(&wheel);
+
+    test_assert("cancel", log.count == 1 && log.id[0] == 1, "Only the timer left alone fired");
+    test_assert("handles", !timer_wheel_pending(&wheel, kept) && !timer_wheel_pending(&wheel, reused),
+                "Fired timers are no longer pending");
+    test_assert("handles", !timer_wheel_pending(&wheel, TIMER_HANDLE_NONE), "The empty handle is never pending");
+    timer_wheel_cleanup(&wheel);
+}
+
+static TimerWheel *rescheduling_wheel;
+static int reschedule_fires;
+
+static void reschedule(void *context, int arg)
+{
+    reschedule_fires++;
+    if (arg > 0)
+        timer_wheel_schedule(rescheduling_wheel, 7, reschedule, context, arg - 1);
+}
+
+static void test_callbacks_reschedule(void)
+{
+    TimerWheel wheel = timer_wheel_create(0);
+    rescheduling_wheel = &wheel;
+    reschedule_fires = 0;
+
+    timer_wheel_schedule(&wheel, 7, reschedule, NULL, 9); // Fires, then schedules itself 9 more times
+    int fired = 0;
+    for (int i = 0; i < 7 * 10; i++)
+        fired += timer_wheel_advance(&wheel);
+
+    test_assert_equal_int("callbacks", 10, reschedule_fires, "A callback can schedule the next timer");
+    test_assert_equal_int("callbacks", 10, fired, "Advance counts the timers it fired");
+    test_assert_equal_int("callbacks", 0, wheel.pending, "The chain ended");
+    timer_wheel_cleanup(&wheel);
+}
+
+static void test_clear(void)
+{
+    TimerWheel wheel = timer_wheel_create(0);
+    static FireLog log;
+    log.count = 0;
+    log.wheel = &wheel;
+
+    TimerHandle handles[50];
+    for (int i = 0; i < 50; i++)
+    {
+        handles[i] = timer_wheel_schedule(&wheel, 1 + i * 97, record_fire, &log, i);
+    }
+    timer_wheel_clear(&wheel);
+
+    bool none_pending = true;
+    for (int i = 0; i < 50; i++)
+    {
+        none_pending = none_pending && !timer_wheel_pending(&wheel, handles[i]);
+    }
+    for (int i = 0; i < 6000; i++)
+        timer_wheel_advance(&wheel);
+
+    test_assert("clear", none_pending && wheel.pending == 0, "Clearing cancels every timer");
+    test_assert_equal_int("clear", 0, log.count, "Cleared timers never fire");
+    timer_wheel_cleanup(&wheel);
+}
+
+static void test_ticks(void)
+{
+    test_assert("ticks", timer_ticks(3.0f) == 3 * SIMULATION_TICK_RATE, "Whole-tick durations are exact");
+    test_assert("ticks", timer_ticks(0.0f) == 1, "Durations are at least one tick");
+    test_assert("ticks", timer_ticks(1.5f / SIMULATION_TICK_RATE) == 2, "Partial ticks round up");
+}
+
+// ============ MAIN TEST RUNNER ============
+
+int main(int argc, char *argv[])
+{
+    printf("╔════════════════════════════════════════╗\n");
+    printf("║        TIMER WHEEL TEST SUITE          ║\n");
+    printf("╚════════════════════════════════════════╝\n");
+
+    test_fires_on_time();
+    test_same_tick_order();
+    test_cancel_and_handles();
+    test_callbacks_reschedule();
+    test_clear();
+    test_ticks();
+
+    print_test_summary();
+
+    return test_stats.failed > 0 ? 1 : 0;
+}